@@ -647,7 +647,11 @@ private:
   }
 
   void addInstruction(uint64_t Offset, MCInst &&Instruction) {
-    Instructions.emplace(Offset, std::forward<MCInst>(Instruction));
+    // Instructions are added in increasing offset order during disassembly,
+    // so hint at the end to get amortized constant-time insertion. The hint
+    // is merely a pessimization for the rare out-of-order insertion.
+    Instructions.emplace_hint(Instructions.end(), Offset,
+                              std::forward<MCInst>(Instruction));
   }
 
   /// Convert CFI instructions to a standard form (remove remember/restore).
@@ -245,6 +245,11 @@ private:
   /// disassembled BinaryFunctions
   BinaryFunction *getBinaryFunctionContainingAddress(uint64_t Address) const;
 
+  /// The function returned by the last successful
+  /// getBinaryFunctionContainingAddress() lookup. Samples cluster in a few
+  /// hot functions, so checking it first avoids most map lookups.
+  mutable BinaryFunction *LastLookupBF{nullptr};
+
   /// Retrieve the location name to be used for samples recorded in \p Func.
   /// If doing BAT translation, link cold parts to the hot part  names (used by
   /// the original binary).  \p Count specifies how many samples were recorded
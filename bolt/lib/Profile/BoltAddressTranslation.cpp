@@ -80,20 +80,20 @@ void BoltAddressTranslation::write(const BinaryContext &BC, raw_ostream &OS) {
         break;
       writeEntriesForBB(Map, *BB, Function.getOutputAddress());
     }
-    Maps.insert(std::pair<uint64_t, MapTy>(Function.getOutputAddress(), Map));
+    Maps.emplace(Function.getOutputAddress(), std::move(Map));
 
     if (!IsSplit)
       continue;
 
     // Cold map
-    Map.clear();
+    Map = MapTy();
     LLVM_DEBUG(dbgs() << " Cold part\n");
     for (const BinaryBasicBlock *const BB : Function.getLayout().blocks()) {
       if (!BB->isCold())
         continue;
       writeEntriesForBB(Map, *BB, Function.cold().getAddress());
     }
-    Maps.insert(std::pair<uint64_t, MapTy>(Function.cold().getAddress(), Map));
+    Maps.emplace(Function.cold().getAddress(), std::move(Map));
     ColdPartSource.insert(std::pair<uint64_t, uint64_t>(
         Function.cold().getAddress(), Function.getOutputAddress()));
   }
@@ -169,11 +169,14 @@ std::error_code BoltAddressTranslation::parse(StringRef Buf) {
     for (uint32_t J = 0; J < NumEntries; ++J) {
       const uint32_t OutputAddr = DE.getU32(&Offset);
       const uint32_t InputAddr = DE.getU32(&Offset);
-      Map.insert(std::pair<uint32_t, uint32_t>(OutputAddr, InputAddr));
+      // Entries were emitted from an ordered map, so hint at the end to get
+      // amortized constant-time insertion.
+      Map.insert(Map.end(),
+                 std::pair<uint32_t, uint32_t>(OutputAddr, InputAddr));
       LLVM_DEBUG(dbgs() << Twine::utohexstr(OutputAddr) << " -> "
                         << Twine::utohexstr(InputAddr) << "\n");
     }
-    Maps.insert(std::pair<uint64_t, MapTy>(Address, Map));
+    Maps.emplace(Address, std::move(Map));
   }
 
   if (Buf.size() - Offset < 4)
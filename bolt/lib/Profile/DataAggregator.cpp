@@ -654,8 +654,17 @@ DataAggregator::getBinaryFunctionContainingAddress(uint64_t Address) const {
   if (!BC->containsAddress(Address))
     return nullptr;
 
-  return BC->getBinaryFunctionContainingAddress(Address, /*CheckPastEnd=*/false,
-                                                /*UseMaxSize=*/true);
+  // Consecutive LBR entries mostly stay within the same few hot functions;
+  // try the previous match before descending into the function map again.
+  if (LastLookupBF && LastLookupBF->containsAddress(Address,
+                                                    /*UseMaxSize=*/true))
+    return LastLookupBF;
+
+  BinaryFunction *BF = BC->getBinaryFunctionContainingAddress(
+      Address, /*CheckPastEnd=*/false, /*UseMaxSize=*/true);
+  if (BF)
+    LastLookupBF = BF;
+  return BF;
 }
 
 StringRef DataAggregator::getLocationName(BinaryFunction &Func,
@@ -2852,6 +2852,9 @@ void RewriteInstance::processProfileData() {
 void RewriteInstance::disassembleFunctions() {
   NamedRegionTimer T("disassembleFunctions", "disassemble functions",
                      TimerGroupName, TimerGroupDesc, opts::TimeRewrite);
+  // Offset of the code in the file.
+  const auto *FileBegin =
+      reinterpret_cast<const uint8_t *>(InputFile->getData().data());
   for (auto &BFI : BC->getBinaryFunctions()) {
     BinaryFunction &Function = BFI.second;
 
@@ -2868,9 +2871,6 @@ void RewriteInstance::disassembleFunctions() {
       continue;
     }
 
-    // Offset of the function in the file.
-    const auto *FileBegin =
-        reinterpret_cast<const uint8_t *>(InputFile->getData().data());
     Function.setFileOffset(FunctionData->begin() - FileBegin);
 
     if (!shouldDisassemble(Function)) {
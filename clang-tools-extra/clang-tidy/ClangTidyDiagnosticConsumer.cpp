@@ -545,7 +545,7 @@ void ClangTidyDiagnosticConsumer::checkFilters(SourceLocation Location,
   StringRef FileName(File->getName());
   LastErrorRelatesToUserCode = LastErrorRelatesToUserCode ||
                                Sources.isInMainFile(Location) ||
-                               getHeaderFilter()->match(FileName);
+                               matchesHeaderFilter(FileName);
 
   unsigned LineNumber = Sources.getExpansionLineNumber(Location);
   LastErrorPassesLineFilter =
@@ -559,6 +559,18 @@ llvm::Regex *ClangTidyDiagnosticConsumer::getHeaderFilter() {
   return HeaderFilter.get();
 }
 
+bool ClangTidyDiagnosticConsumer::matchesHeaderFilter(StringRef FileName) {
+  // Diagnostics cluster in a small set of headers, so memoize the regex
+  // result per file name instead of re-running the match for every
+  // diagnostic.
+  auto It = HeaderFilterMatches.find(FileName);
+  if (It != HeaderFilterMatches.end())
+    return It->second;
+  bool Matches = getHeaderFilter()->match(FileName);
+  HeaderFilterMatches[FileName] = Matches;
+  return Matches;
+}
+
 void ClangTidyDiagnosticConsumer::removeIncompatibleErrors() {
   // Each error is modelled as the set of intervals in which it applies
   // replacements. To detect overlapping replacements, we use a sweep line
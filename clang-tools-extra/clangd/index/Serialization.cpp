@@ -220,11 +220,13 @@ llvm::Expected<StringTableIn> readStringTable(llvm::StringRef Data) {
   if (R.err())
     return error("Truncated string table");
 
+  StringTableIn Table;
   llvm::StringRef Uncompressed;
-  llvm::SmallVector<uint8_t, 0> UncompressedStorage;
-  if (UncompressedSize == 0) // No compression
-    Uncompressed = R.rest();
-  else if (llvm::compression::zlib::isAvailable()) {
+  if (UncompressedSize == 0) {
+    // No compression. Copy the table into the arena in one block, the
+    // individual strings are slices of it.
+    Uncompressed = llvm::StringRef(R.rest()).copy(Table.Arena);
+  } else if (llvm::compression::zlib::isAvailable()) {
     // Don't allocate a massive buffer if UncompressedSize was corrupted
     // This is effective for sharded index, but not big monolithic ones, as
     // once compressed size reaches 4MB nothing can be ruled out.
@@ -234,22 +236,25 @@ llvm::Expected<StringTableIn> readStringTable(llvm::StringRef Data) {
       return error("Bad stri table: uncompress {0} -> {1} bytes is implausible",
                    R.rest().size(), UncompressedSize);
 
+    // Uncompress directly into the arena rather than into a temporary that
+    // each string is then copied out of: the strings are slices of the block.
+    uint8_t *UncompressedStorage =
+        Table.Arena.Allocate<uint8_t>(UncompressedSize);
+    size_t Size = UncompressedSize;
     if (llvm::Error E = llvm::compression::zlib::uncompress(
-            llvm::arrayRefFromStringRef(R.rest()), UncompressedStorage,
-            UncompressedSize))
+            llvm::arrayRefFromStringRef(R.rest()), UncompressedStorage, Size))
       return std::move(E);
-    Uncompressed = toStringRef(UncompressedStorage);
+    Uncompressed = llvm::StringRef(
+        reinterpret_cast<const char *>(UncompressedStorage), Size);
   } else
     return error("Compressed string table, but zlib is unavailable");
 
-  StringTableIn Table;
-  llvm::StringSaver Saver(Table.Arena);
   R = Reader(Uncompressed);
   for (Reader R(Uncompressed); !R.eof();) {
     auto Len = R.rest().find(0);
     if (Len == llvm::StringRef::npos)
       return error("Bad string table: not null terminated");
-    Table.Strings.push_back(Saver.save(R.consume(Len)));
+    Table.Strings.push_back(R.consume(Len));
     R.consume8();
   }
   if (R.err())
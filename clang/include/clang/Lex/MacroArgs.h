@@ -36,6 +36,13 @@ class MacroArgs final
   /// concatenated together, with 'EOF' markers at the end of each argument.
   unsigned NumUnexpArgTokens;
 
+  /// NumAllocatedUnexpArgTokens - The number of tokens the trailing allocation
+  /// can hold.  This can exceed NumUnexpArgTokens when the object is recycled
+  /// from the preprocessor's free list for a smaller invocation, and is what
+  /// the free list matches against so that a recycled object keeps serving
+  /// invocations up to its original size.
+  unsigned NumAllocatedUnexpArgTokens;
+
   /// VarargsElided - True if this is a C99 style varargs macro invocation and
   /// there was no argument specified for the "..." argument.  If the argument
   /// was specified (even empty) or this isn't a C99 style varargs function, or
@@ -56,8 +63,9 @@ class MacroArgs final
   unsigned NumMacroArgs;
 
   MacroArgs(unsigned NumToks, bool varargsElided, unsigned MacroArgs)
-      : NumUnexpArgTokens(NumToks), VarargsElided(varargsElided),
-        ArgCache(nullptr), NumMacroArgs(MacroArgs) {}
+      : NumUnexpArgTokens(NumToks), NumAllocatedUnexpArgTokens(NumToks),
+        VarargsElided(varargsElided), ArgCache(nullptr),
+        NumMacroArgs(MacroArgs) {}
   ~MacroArgs() = default;
 
 public:
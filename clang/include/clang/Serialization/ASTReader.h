@@ -2178,12 +2178,9 @@ public:
                                          SourceLocation Loc) const {
     if (!ModuleFile.ModuleOffsetMap.empty())
       ReadModuleOffsetMap(ModuleFile);
-    assert(ModuleFile.SLocRemap.find(Loc.getOffset()) !=
-               ModuleFile.SLocRemap.end() &&
-           "Cannot find offset to remap.");
-    SourceLocation::IntTy Remap =
-        ModuleFile.SLocRemap.find(Loc.getOffset())->second;
-    return Loc.getLocWithOffset(Remap);
+    auto It = ModuleFile.SLocRemap.find(Loc.getOffset());
+    assert(It != ModuleFile.SLocRemap.end() && "Cannot find offset to remap.");
+    return Loc.getLocWithOffset(It->second);
   }
 
   /// Read a source location.
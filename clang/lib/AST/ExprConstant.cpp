@@ -848,6 +848,11 @@ namespace {
     /// for the stored APValues.
     std::map<DynamicAllocLValue, DynAlloc, DynAllocOrder> HeapAllocs;
 
+    /// Cached case-label bounds, so that executing a switch repeatedly (in a
+    /// loop or a recursive call) does not re-evaluate the case constants each
+    /// time.
+    llvm::DenseMap<const CaseStmt *, std::pair<APSInt, APSInt>> CaseValues;
+
     /// The number of heap allocations performed so far in this evaluation.
     unsigned NumHeapAllocs = 0;
 
@@ -4992,7 +4997,6 @@ static EvalStmtResult EvaluateSwitch(StmtResult &Result, EvalInfo &Info,
   }
 
   // Find the switch case corresponding to the value of the condition.
-  // FIXME: Cache this lookup.
   const SwitchCase *Found = nullptr;
   for (const SwitchCase *SC = SS->getSwitchCaseList(); SC;
        SC = SC->getNextSwitchCase()) {
@@ -5002,10 +5006,15 @@ static EvalStmtResult EvaluateSwitch(StmtResult &Result, EvalInfo &Info,
     }
 
     const CaseStmt *CS = cast<CaseStmt>(SC);
-    APSInt LHS = CS->getLHS()->EvaluateKnownConstInt(Info.Ctx);
-    APSInt RHS = CS->getRHS() ? CS->getRHS()->EvaluateKnownConstInt(Info.Ctx)
-                              : LHS;
-    if (LHS <= Value && Value <= RHS) {
+    auto Cached = Info.CaseValues.find(CS);
+    if (Cached == Info.CaseValues.end()) {
+      APSInt LHS = CS->getLHS()->EvaluateKnownConstInt(Info.Ctx);
+      APSInt RHS = CS->getRHS() ? CS->getRHS()->EvaluateKnownConstInt(Info.Ctx)
+                                : LHS;
+      Cached =
+          Info.CaseValues.try_emplace(CS, std::move(LHS), std::move(RHS)).first;
+    }
+    if (Cached->second.first <= Value && Value <= Cached->second.second) {
       Found = SC;
       break;
     }
@@ -1036,19 +1036,29 @@ private:
     const bool EnableCheckProfiling = Options.CheckProfiling.has_value();
     TimeBucketRegion Timer;
     auto &Matchers = this->Matchers->DeclOrStmt;
+    // Whether the node is skipped under traverse-ignore semantics depends
+    // only on the effective traversal kind, not on the individual matcher.
+    // With many matchers registered for the same node kind, evaluate the
+    // query once per traversal kind instead of once per matcher.
+    const TraversalKind AmbientTK =
+        getASTContext().getParentMapContext().getTraversalKind();
+    llvm::Optional<bool> NodeIsIgnored[2];
     for (unsigned short I : Filter) {
       auto &MP = Matchers[I];
       if (EnableCheckProfiling)
         Timer.setBucket(&TimeByBucket[MP.second->getID()]);
-      BoundNodesTreeBuilder Builder;
 
-      {
-        TraversalKindScope RAII(getASTContext(), MP.first.getTraversalKind());
-        if (getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
-            DynNode)
-          continue;
+      TraversalKind TK = MP.first.getTraversalKind().value_or(AmbientTK);
+      llvm::Optional<bool> &Ignored = NodeIsIgnored[TK];
+      if (!Ignored) {
+        TraversalKindScope RAII(getASTContext(), TK);
+        Ignored = getASTContext().getParentMapContext().traverseIgnored(
+                      DynNode) != DynNode;
       }
+      if (*Ignored)
+        continue;
 
+      BoundNodesTreeBuilder Builder;
       CurMatchRAII RAII(*this, MP.second, DynNode);
       if (MP.first.matches(DynNode, this, &Builder)) {
         MatchVisitor Visitor(*this, ActiveASTContext, MP.second);
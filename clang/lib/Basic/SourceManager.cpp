@@ -1253,6 +1253,9 @@ unsigned SourceManager::getPresumedColumnNumber(SourceLocation Loc,
   return PLoc.getColumn();
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#else
 // Check if mutli-byte word x has bytes between m and n, included. This may also
 // catch bytes equal to n + 1.
 // The returned value holds a 0x80 at each byte position that holds a match.
@@ -1265,6 +1268,7 @@ static constexpr inline T likelyhasbetween(T x, unsigned char m,
            (~static_cast<T>(0) / 255 * (127 - (m - 1))))) &
          ~static_cast<T>(0) / 255 * 128;
 }
+#endif
 
 LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
                                          llvm::BumpPtrAllocator &Alloc) {
@@ -1281,6 +1285,41 @@ LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
   const std::size_t BufLen = End - Buf;
 
   unsigned I = 0;
+
+#ifdef __SSE2__
+  // Scan 16 bytes at a time for new lines, skipping over full chunks that
+  // contain none. Chunks that do contain a line break are handled with the
+  // byte-at-a-time code below, which also takes care of a \r\n pair straddling
+  // a chunk boundary.
+  const __m128i CRs = _mm_set1_epi8('\r');
+  const __m128i LFs = _mm_set1_epi8('\n');
+  while (I + sizeof(__m128i) <= BufLen) {
+    __m128i Chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Buf + I));
+    unsigned Mask = _mm_movemask_epi8(_mm_or_si128(
+        _mm_cmpeq_epi8(Chunk, CRs), _mm_cmpeq_epi8(Chunk, LFs)));
+    if (!Mask) {
+      I += sizeof(__m128i);
+      continue;
+    }
+
+    // Process the rest of the chunk (at most 16 bytes) a byte at a time,
+    // starting at the first line break.
+    const unsigned Limit = I + sizeof(__m128i);
+    I += llvm::countTrailingZeros(Mask);
+    while (I < Limit) {
+      if (Buf[I] == '\n') {
+        LineOffsets.push_back(I + 1);
+      } else if (Buf[I] == '\r') {
+        // If this is \r\n, skip both characters.
+        if (I + 1 < BufLen && Buf[I + 1] == '\n')
+          ++I;
+        LineOffsets.push_back(I + 1);
+      }
+      ++I;
+    }
+  }
+#else
   uint64_t Word;
 
   // scan sizeof(Word) bytes at a time for new lines.
@@ -1314,6 +1353,7 @@ LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
       }
     } while (I < BufLen - sizeof(Word) - 1);
   }
+#endif
 
   // Handle tail using a regular check.
   while (I < BufLen) {
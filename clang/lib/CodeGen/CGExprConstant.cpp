@@ -1005,6 +1005,84 @@ EmitArrayConstant(CodeGenModule &CGM, llvm::ArrayType *DesiredType,
   return llvm::ConstantStruct::get(SType, Elements);
 }
 
+/// Emit a fully-initialized array of integer or floating-point values directly
+/// as a ConstantDataArray, without materializing a uniqued ConstantInt or
+/// ConstantFP for every element. For large generated tables the per-element
+/// Constant objects, and the context-lifetime uniquing maps behind them,
+/// dominate IRGen time and memory; the packed data representation is what
+/// such initializers are lowered to anyway. Returns nullptr if the array must
+/// go down the generic element-by-element path instead.
+static llvm::Constant *tryEmitConstantDataArray(CodeGenModule &CGM,
+                                                const APValue &Value,
+                                                const ArrayType *ArrayTy) {
+  unsigned NumElements = Value.getArraySize();
+  if (NumElements == 0 || Value.getArrayInitializedElts() != NumElements ||
+      Value.hasArrayFiller())
+    return nullptr;
+
+  // Bools widen to their memory representation, and bit-ints may not match
+  // any ConstantDataArray element width; leave both to the generic path.
+  QualType EltQT = ArrayTy->getElementType();
+  if (EltQT->isBooleanType() || EltQT->isBitIntType() ||
+      (!EltQT->isIntegerType() && !EltQT->isRealFloatingType()))
+    return nullptr;
+
+  llvm::Type *EltTy = CGM.getTypes().ConvertTypeForMem(EltQT);
+  if (!llvm::ConstantDataArray::isElementTypeCompatible(EltTy))
+    return nullptr;
+
+  llvm::LLVMContext &Ctx = CGM.getLLVMContext();
+  if (auto *IntTy = dyn_cast<llvm::IntegerType>(EltTy)) {
+    auto EmitInts = [&](auto Zero) -> llvm::Constant * {
+      using ElemTy = decltype(Zero);
+      SmallVector<ElemTy, 32> Elts;
+      Elts.reserve(NumElements);
+      for (unsigned I = 0; I != NumElements; ++I) {
+        const APValue &Elt = Value.getArrayInitializedElt(I);
+        if (!Elt.isInt() || Elt.getInt().getBitWidth() != IntTy->getBitWidth())
+          return nullptr;
+        Elts.push_back(static_cast<ElemTy>(Elt.getInt().getZExtValue()));
+      }
+      return llvm::ConstantDataArray::get(Ctx, Elts);
+    };
+    switch (IntTy->getBitWidth()) {
+    case 8:
+      return EmitInts(uint8_t(0));
+    case 16:
+      return EmitInts(uint16_t(0));
+    case 32:
+      return EmitInts(uint32_t(0));
+    case 64:
+      return EmitInts(uint64_t(0));
+    default:
+      return nullptr;
+    }
+  }
+
+  auto EmitFloats = [&](auto Zero) -> llvm::Constant * {
+    using ElemTy = decltype(Zero);
+    SmallVector<ElemTy, 32> Elts;
+    Elts.reserve(NumElements);
+    for (unsigned I = 0; I != NumElements; ++I) {
+      const APValue &Elt = Value.getArrayInitializedElt(I);
+      if (!Elt.isFloat())
+        return nullptr;
+      llvm::APInt Bits = Elt.getFloat().bitcastToAPInt();
+      if (Bits.getBitWidth() != sizeof(ElemTy) * 8)
+        return nullptr;
+      Elts.push_back(static_cast<ElemTy>(Bits.getZExtValue()));
+    }
+    return llvm::ConstantDataArray::getFP(EltTy, Elts);
+  };
+  if (EltTy->isHalfTy() || EltTy->isBFloatTy())
+    return EmitFloats(uint16_t(0));
+  if (EltTy->isFloatTy())
+    return EmitFloats(uint32_t(0));
+  if (EltTy->isDoubleTy())
+    return EmitFloats(uint64_t(0));
+  return nullptr;
+}
+
 // This class only needs to handle arrays, structs and unions. Outside C++11
 // mode, we don't currently constant fold those types.  All other types are
 // handled by constant folding.
@@ -2157,6 +2235,11 @@ llvm::Constant *ConstantEmitter::tryEmitPrivate(const APValue &Value,
     unsigned NumElements = Value.getArraySize();
     unsigned NumInitElts = Value.getArrayInitializedElts();
 
+    // Fully-initialized arrays of scalar built-in types can skip the
+    // element-by-element path below.
+    if (llvm::Constant *C = tryEmitConstantDataArray(CGM, Value, ArrayTy))
+      return C;
+
     // Emit array filler, if there is one.
     llvm::Constant *Filler = nullptr;
     if (Value.hasArrayFiller()) {
@@ -23,6 +23,8 @@
 #include "clang/Driver/Options.h"
 #include "clang/Driver/Tool.h"
 #include "clang/Driver/ToolChain.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Option/ArgList.h"
 #include "llvm/Support/CodeGen.h"
 #include "llvm/Support/Path.h"
@@ -1997,6 +1999,26 @@ void Generic_GCC::GCCInstallationDetector::init(
                            CandidateTripleAliases, CandidateBiarchLibDirs,
                            CandidateBiarchTripleAliases);
 
+  // The exact target triple and the extra aliases are scanned before the
+  // generic candidate triples, which frequently repeat both of them. Every
+  // scan of a triple costs directory traversals in each candidate lib dir,
+  // so drop the repeats up front. This does not change the chosen
+  // installation: rescanning a triple only revisits paths that have already
+  // been recorded in CandidateGCCInstallPaths. The biarch aliases are
+  // deduplicated separately because they are scanned with a biarch suffix.
+  {
+    llvm::StringSet<> SeenTriples, SeenBiarchTriples;
+    SeenTriples.insert(TargetTriple.str());
+    for (StringRef Candidate : ExtraTripleAliases)
+      SeenTriples.insert(Candidate);
+    llvm::erase_if(CandidateTripleAliases, [&](StringRef Candidate) {
+      return !SeenTriples.insert(Candidate).second;
+    });
+    llvm::erase_if(CandidateBiarchTripleAliases, [&](StringRef Candidate) {
+      return !SeenBiarchTriples.insert(Candidate).second;
+    });
+  }
+
   // Compute the set of prefixes for our search.
   SmallVector<std::string, 8> Prefixes;
   StringRef GCCToolchainDir = getGCCToolchainDir(Args, D.SysRoot);
@@ -1442,6 +1442,16 @@ static bool compileModuleAndReadASTBehindLock(
       Locked.unsafeRemoveLockFile();
       [[fallthrough]];
     case llvm::LockFileManager::LFS_Owned:
+      // Contending processes acquire the lock one at a time, so by the time we
+      // own it a previous owner may already have built this module. Try to
+      // read it before rebuilding; a missing or out-of-date file here is not
+      // an error, it just means the build is up to us.
+      if (ImportingInstance.getASTReader()->ReadAST(
+              ModuleFileName, serialization::MK_ImplicitModule, ImportLoc,
+              ASTReader::ARR_Missing | ASTReader::ARR_OutOfDate) ==
+          ASTReader::Success)
+        return true;
+
       // We're responsible for building the module ourselves.
       return compileModuleAndReadASTImpl(ImportingInstance, ImportLoc,
                                          ModuleNameLoc, Module, ModuleFileName);
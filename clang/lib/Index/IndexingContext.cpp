@@ -49,6 +49,23 @@ bool IndexingContext::shouldIndexTemplateParameters() const {
   return IndexOpts.IndexTemplateParameters;
 }
 
+IndexingContext::IndexedFileKind
+IndexingContext::getIndexedFileKind(FileID FID) {
+  auto Inserted = FileKindCache.try_emplace(FID, IndexedFileKind::Invalid);
+  if (!Inserted.second)
+    return Inserted.first->second;
+
+  SourceManager &SM = Ctx->getSourceManager();
+  bool Invalid = false;
+  const SrcMgr::SLocEntry &SEntry = SM.getSLocEntry(FID, &Invalid);
+  if (!Invalid && SEntry.isFile())
+    Inserted.first->second =
+        SEntry.getFile().getFileCharacteristic() == SrcMgr::C_User
+            ? IndexedFileKind::User
+            : IndexedFileKind::System;
+  return Inserted.first->second;
+}
+
 bool IndexingContext::handleDecl(const Decl *D,
                                  SymbolRoleSet Roles,
                                  ArrayRef<SymbolRelation> Relations) {
@@ -118,12 +135,11 @@ bool IndexingContext::importedModule(const ImportDecl *ImportD) {
   if (FID.isInvalid())
     return true;
 
-  bool Invalid = false;
-  const SrcMgr::SLocEntry &SEntry = SM.getSLocEntry(FID, &Invalid);
-  if (Invalid || !SEntry.isFile())
+  IndexedFileKind FileKind = getIndexedFileKind(FID);
+  if (FileKind == IndexedFileKind::Invalid)
     return true;
 
-  if (SEntry.getFile().getFileCharacteristic() != SrcMgr::C_User) {
+  if (FileKind == IndexedFileKind::System) {
     switch (IndexOpts.SystemSymbolFilter) {
     case IndexingOptions::SystemSymbolFilterKind::None:
       return true;
@@ -370,12 +386,11 @@ bool IndexingContext::handleDeclOccurrence(const Decl *D, SourceLocation Loc,
   if (FID.isInvalid())
     return true;
 
-  bool Invalid = false;
-  const SrcMgr::SLocEntry &SEntry = SM.getSLocEntry(FID, &Invalid);
-  if (Invalid || !SEntry.isFile())
+  IndexedFileKind FileKind = getIndexedFileKind(FID);
+  if (FileKind == IndexedFileKind::Invalid)
     return true;
 
-  if (SEntry.getFile().getFileCharacteristic() != SrcMgr::C_User) {
+  if (FileKind == IndexedFileKind::System) {
     switch (IndexOpts.SystemSymbolFilter) {
     case IndexingOptions::SystemSymbolFilterKind::None:
       return true;
@@ -498,10 +513,5 @@ bool IndexingContext::shouldIndexMacroOccurrence(bool IsRef,
   if (FID.isInvalid())
     return false;
 
-  bool Invalid = false;
-  const SrcMgr::SLocEntry &SEntry = SM.getSLocEntry(FID, &Invalid);
-  if (Invalid || !SEntry.isFile())
-    return false;
-
-  return SEntry.getFile().getFileCharacteristic() == SrcMgr::C_User;
+  return getIndexedFileKind(FID) == IndexedFileKind::User;
 }
@@ -12,9 +12,11 @@
 #include "clang/Basic/IdentifierTable.h"
 #include "clang/Basic/LLVM.h"
 #include "clang/Index/IndexSymbol.h"
+#include "clang/Basic/SourceLocation.h"
 #include "clang/Index/IndexingAction.h"
 #include "clang/Lex/MacroInfo.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 
 namespace clang {
   class ASTContext;
@@ -126,6 +128,17 @@ private:
 
   bool shouldIndexMacroOccurrence(bool IsRef, SourceLocation Loc);
 
+  /// What kind of file an occurrence is located in, for the purposes of the
+  /// system symbol filter.
+  enum class IndexedFileKind { Invalid, User, System };
+
+  /// Classify \p FID as user code, system code, or neither (e.g. a built-in
+  /// or macro-expansion entry). This is queried for every occurrence and
+  /// almost always for the same few files, so the result is memoized.
+  IndexedFileKind getIndexedFileKind(FileID FID);
+
+  llvm::DenseMap<FileID, IndexedFileKind> FileKindCache;
+
   bool handleDeclOccurrence(const Decl *D, SourceLocation Loc,
                             bool IsRef, const Decl *Parent,
                             SymbolRoleSet Roles,
@@ -286,17 +286,31 @@ void IncrementalParser::CleanUpPTU(PartialTranslationUnit &PTU) {
   TranslationUnitDecl *MostRecentTU = PTU.TUPart;
   TranslationUnitDecl *FirstTU = MostRecentTU->getFirstDecl();
   if (StoredDeclsMap *Map = FirstTU->getPrimaryContext()->getLookupPtr()) {
-    for (auto I = Map->begin(); I != Map->end(); ++I) {
-      StoredDeclsList &List = I->second;
-      DeclContextLookupResult R = List.getLookupResult();
-      for (NamedDecl *D : R) {
-        if (D->getTranslationUnitDecl() == MostRecentTU) {
-          List.remove(D);
-        }
+    // Names introduced by the undone PTU usually were not declared before, so
+    // the whole entry can be dropped. Only when older declarations share the
+    // name do we need to take the list apart. Erasure is deferred to keep the
+    // map iterators stable.
+    llvm::SmallVector<DeclarationName, 8> NamesToErase;
+    for (auto &Entry : *Map) {
+      StoredDeclsList &List = Entry.second;
+      llvm::SmallVector<NamedDecl *, 4> DeclsToRemove;
+      bool RemoveWholeEntry = true;
+      for (NamedDecl *D : List.getLookupResult()) {
+        if (D->getTranslationUnitDecl() == MostRecentTU)
+          DeclsToRemove.push_back(D);
+        else
+          RemoveWholeEntry = false;
       }
-      if (List.isNull())
-        Map->erase(I);
+      if (DeclsToRemove.empty())
+        continue;
+      if (RemoveWholeEntry)
+        NamesToErase.push_back(Entry.first);
+      else
+        for (NamedDecl *D : DeclsToRemove)
+          List.remove(D);
     }
+    for (DeclarationName Name : NamesToErase)
+      Map->erase(Name);
   }
 }
 
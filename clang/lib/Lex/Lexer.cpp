@@ -2367,6 +2367,13 @@ bool Lexer::SkipWhitespace(Token &Result, const char *CurPtr,
   return false;
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 /// We have just read the // characters from input.  Skip until we find the
 /// newline character that terminates the comment.  Then update BufferPtr and
 /// return.
@@ -2401,6 +2408,32 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip over large runs of uninteresting comment text in bulk. Stop at the
+    // first newline, NUL (potentially EOF), or non-ASCII byte, all of which
+    // need the character-at-a-time loop below. Unlike the block comment scan
+    // this stops at '\0', so it is safe at a code-completion point.
+    {
+      const char *ChunkStart = CurPtr;
+      while (CurPtr + 16 < BufferEnd) {
+        __m128i Chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(CurPtr));
+        int Mask =
+            _mm_movemask_epi8(Chunk) |
+            _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\n'))) |
+            _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\r'))) |
+            _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_setzero_si128()));
+        if (Mask != 0) {
+          CurPtr += llvm::countTrailingZeros<unsigned>(Mask);
+          break;
+        }
+        CurPtr += 16;
+      }
+      // Everything skipped was plain ASCII comment text.
+      if (CurPtr != ChunkStart)
+        UnicodeDecodingAlreadyDiagnosed = false;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -2639,13 +2672,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
@@ -30,18 +30,20 @@ MacroArgs *MacroArgs::create(const MacroInfo *MI,
   unsigned ClosestMatch = ~0U;
 
   // See if we have an entry with a big enough argument list to reuse on the
-  // free list.  If so, reuse it.
+  // free list.  If so, reuse it.  Entries are matched on their allocated
+  // capacity, not the size of the last invocation they served, so recycling a
+  // large entry for a small invocation doesn't shrink it.
   for (MacroArgs **Entry = &PP.MacroArgCache; *Entry;
        Entry = &(*Entry)->ArgCache) {
-    if ((*Entry)->NumUnexpArgTokens >= UnexpArgTokens.size() &&
-        (*Entry)->NumUnexpArgTokens < ClosestMatch) {
+    if ((*Entry)->NumAllocatedUnexpArgTokens >= UnexpArgTokens.size() &&
+        (*Entry)->NumAllocatedUnexpArgTokens < ClosestMatch) {
       ResultEnt = Entry;
 
       // If we have an exact match, use it.
-      if ((*Entry)->NumUnexpArgTokens == UnexpArgTokens.size())
+      if ((*Entry)->NumAllocatedUnexpArgTokens == UnexpArgTokens.size())
         break;
       // Otherwise, use the best fit.
-      ClosestMatch = (*Entry)->NumUnexpArgTokens;
+      ClosestMatch = (*Entry)->NumAllocatedUnexpArgTokens;
     }
   }
   MacroArgs *Result;
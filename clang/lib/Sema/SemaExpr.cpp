@@ -18096,7 +18096,10 @@ void Sema::MarkFunctionReferenced(SourceLocation Loc, FunctionDecl *Func,
             // expression evaluator needing to call back into Sema if it sees a
             // call to such a function.
             InstantiateFunctionDefinition(PointOfInstantiation, Func);
-          else {
+          else if (!Func->instantiationIsPending()) {
+            // Queue the instantiation unless it is already pending; uses of
+            // explicitly-instantiated specializations would otherwise push a
+            // redundant entry for every reference.
             Func->setInstantiationIsPending(true);
             PendingInstantiations.push_back(
                 std::make_pair(Func, PointOfInstantiation));
@@ -2320,6 +2320,11 @@ static bool LookupQualifiedNameInUsingDirectives(Sema &S, LookupResult &R,
       Queue.push_back(ND);
   }
 
+  // In the common case the namespace nominates nothing, and the direct lookup
+  // that already failed was the whole story.
+  if (Queue.empty())
+    return false;
+
   // The easiest way to implement the restriction in [namespace.qual]p5
   // is to check whether any of the individual results found a tag
   // and, if so, to declare an ambiguity if the final result is not
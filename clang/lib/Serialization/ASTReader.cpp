@@ -1453,13 +1453,24 @@ bool ASTReader::ReadSLocEntry(int ID) {
     unsigned RecCode = MaybeRecCode.get();
 
     if (RecCode == SM_SLOC_BUFFER_BLOB_COMPRESSED) {
-      if (!llvm::compression::zlib::isAvailable()) {
-        Error("zlib is not available");
+      // The blob is either zlib- or zstd-compressed; tell them apart by the
+      // leading byte. Zlib streams always start with 0x78, while a zstd
+      // frame's magic number begins with 0x28.
+      bool IsZlib = !Blob.empty() && Blob[0] == '\x78';
+      if (IsZlib ? !llvm::compression::zlib::isAvailable()
+                 : !llvm::compression::zstd::isAvailable()) {
+        Error(IsZlib ? "zlib is not available" : "zstd is not available");
         return nullptr;
       }
       SmallVector<uint8_t, 0> Uncompressed;
-      if (llvm::Error E = llvm::compression::zlib::uncompress(
-              llvm::arrayRefFromStringRef(Blob), Uncompressed, Record[0])) {
+      llvm::Error E =
+          IsZlib ? llvm::compression::zlib::uncompress(
+                       llvm::arrayRefFromStringRef(Blob), Uncompressed,
+                       Record[0])
+                 : llvm::compression::zstd::uncompress(
+                       llvm::arrayRefFromStringRef(Blob), Uncompressed,
+                       Record[0]);
+      if (E) {
         Error("could not decompress embedded file contents: " +
               llvm::toString(std::move(E)));
         return nullptr;
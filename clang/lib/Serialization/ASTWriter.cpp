@@ -1982,8 +1982,19 @@ static void emitBlob(llvm::BitstreamWriter &Stream, StringRef Blob,
   using RecordDataType = ASTWriter::RecordData::value_type;
 
   // Compress the buffer if possible. We expect that almost all PCM
-  // consumers will not want its contents.
+  // consumers will not want its contents. Prefer zstd, which compresses and
+  // (more importantly for consumers that do read the buffer, like preamble
+  // reuse) decompresses substantially faster than zlib; the reader
+  // distinguishes the two formats by their leading bytes.
   SmallVector<uint8_t, 0> CompressedBuffer;
+  if (llvm::compression::zstd::isAvailable()) {
+    llvm::compression::zstd::compress(
+        llvm::arrayRefFromStringRef(Blob.drop_back(1)), CompressedBuffer);
+    RecordDataType Record[] = {SM_SLOC_BUFFER_BLOB_COMPRESSED, Blob.size() - 1};
+    Stream.EmitRecordWithBlob(SLocBufferBlobCompressedAbbrv, Record,
+                              llvm::toStringRef(CompressedBuffer));
+    return;
+  }
   if (llvm::compression::zlib::isAvailable()) {
     llvm::compression::zlib::compress(
         llvm::arrayRefFromStringRef(Blob.drop_back(1)), CompressedBuffer);
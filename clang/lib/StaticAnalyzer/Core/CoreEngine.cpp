@@ -131,9 +131,11 @@ bool CoreEngine::ExecuteWorkList(const LocationContext *L, unsigned MaxSteps,
 
   // Cap our pre-reservation in the event that the user specifies
   // a very large number of maximum steps.
-  const unsigned PreReservationCap = 4000000;
-  if(!UnlimitedSteps)
-    G.reserve(std::min(MaxSteps, PreReservationCap));
+  static constexpr unsigned PreReservationCap = 4000000;
+  // Most entry points finish well before the step limit, so defer reserving
+  // the node hash table for the full limit until the exploration has run long
+  // enough to suggest it will actually get there.
+  static constexpr unsigned StepsBeforeReservation = 1024;
 
   auto ProcessWList = [this, UnlimitedSteps](unsigned MaxSteps) {
     unsigned Steps = MaxSteps;
@@ -144,6 +146,8 @@ bool CoreEngine::ExecuteWorkList(const LocationContext *L, unsigned MaxSteps,
           break;
         }
         --Steps;
+        if (MaxSteps - Steps == StepsBeforeReservation)
+          G.reserve(std::min(MaxSteps, PreReservationCap));
       }
 
       NumSteps++;
@@ -42,17 +42,20 @@ DependencyScanningWorkerFilesystem::readFile(StringRef Filename) {
 
 EntryRef DependencyScanningWorkerFilesystem::scanForDirectivesIfNecessary(
     const CachedFileSystemEntry &Entry, StringRef Filename, bool Disable) {
-  if (Entry.isError() || Entry.isDirectory() || Disable ||
-      !shouldScanForDirectives(Filename))
+  if (Entry.isError() || Entry.isDirectory() || Disable)
     return EntryRef(Filename, Entry);
 
   CachedFileContents *Contents = Entry.getCachedContents();
   assert(Contents && "contents not initialized");
 
-  // Double-checked locking.
+  // Double-checked locking. An already-completed scan is the common case for
+  // shared headers, so check this before the per-filename extension filter.
   if (Contents->DepDirectives.load())
     return EntryRef(Filename, Entry);
 
+  if (!shouldScanForDirectives(Filename))
+    return EntryRef(Filename, Entry);
+
   std::lock_guard<std::mutex> GuardLock(Contents->ValueLock);
 
   // Double-checked locking.
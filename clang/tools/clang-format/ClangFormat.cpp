@@ -19,10 +19,12 @@
 #include "clang/Basic/Version.h"
 #include "clang/Format/Format.h"
 #include "clang/Rewrite/Core/Rewriter.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include <fstream>
 
@@ -384,6 +386,37 @@ static void outputXML(const Replacements &Replaces,
   outs() << "</replacements>\n";
 }
 
+// Returns the style to use for AssumedFileName, memoizing the result per
+// (directory, language). A single invocation commonly formats many files that
+// live in a handful of directories, and getStyle() repeats the whole
+// .clang-format search for each of them: two stat calls per parent directory
+// plus reading and re-parsing every config file it finds. The language is part
+// of the key because the search skips config files that do not support the
+// file's language. Config files are assumed not to change during one run.
+static llvm::Expected<FormatStyle> getCachedStyle(StringRef AssumedFileName,
+                                                  StringRef Code) {
+  static llvm::StringMap<FormatStyle> CachedStyles;
+
+  SmallString<128> CacheKey(AssumedFileName);
+  if (llvm::sys::fs::make_absolute(CacheKey))
+    CacheKey.clear();
+  if (!CacheKey.empty()) {
+    llvm::sys::path::remove_filename(CacheKey);
+    CacheKey += '\0';
+    CacheKey += getLanguageName(guessLanguage(AssumedFileName, Code));
+    auto It = CachedStyles.find(CacheKey);
+    if (It != CachedStyles.end())
+      return It->second;
+  }
+
+  llvm::Expected<FormatStyle> FormatStyle =
+      getStyle(Style, AssumedFileName, FallbackStyle, Code, nullptr,
+               WNoErrorList.isSet(WNoError::Unknown));
+  if (FormatStyle && !CacheKey.empty())
+    CachedStyles.insert({CacheKey, *FormatStyle});
+  return FormatStyle;
+}
+
 class ClangFormatDiagConsumer : public DiagnosticConsumer {
   virtual void anchor() {}
 
@@ -438,8 +471,7 @@ static bool format(StringRef FileName) {
   }
 
   llvm::Expected<FormatStyle> FormatStyle =
-      getStyle(Style, AssumedFileName, FallbackStyle, Code->getBuffer(),
-               nullptr, WNoErrorList.isSet(WNoError::Unknown));
+      getCachedStyle(AssumedFileName, Code->getBuffer());
   if (!FormatStyle) {
     llvm::errs() << llvm::toString(FormatStyle.takeError()) << "\n";
     return true;
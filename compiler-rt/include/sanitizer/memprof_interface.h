@@ -58,6 +58,14 @@ const char *__memprof_default_options(void);
 /// \returns 0 on success.
 int __memprof_profile_dump(void);
 
+/// Closes the existing file descriptor, if it is valid and not stdout or
+/// stderr, and resets the profile state: all MemInfoBlocks accumulated so far
+/// are dropped, so a subsequent dump covers only the allocations made after
+/// the reset. Together with __memprof_profile_dump() this allows a
+/// long-running process to emit a series of self-contained profiles with a
+/// bounded memory footprint.
+void __memprof_profile_reset(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
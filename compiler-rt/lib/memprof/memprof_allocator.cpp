@@ -22,6 +22,7 @@
 #include "profile/MemProfData.inc"
 #include "sanitizer_common/sanitizer_allocator_checks.h"
 #include "sanitizer_common/sanitizer_allocator_interface.h"
+#include "sanitizer_common/sanitizer_allocator_internal.h"
 #include "sanitizer_common/sanitizer_allocator_report.h"
 #include "sanitizer_common/sanitizer_errno.h"
 #include "sanitizer_common/sanitizer_file.h"
@@ -306,6 +307,28 @@ struct Allocator {
     allocator.ForceUnlock();
   }
 
+  static void CollectKeyCallback(const uptr Key, LockedMemInfoBlock *const &,
+                                 void *Arg) {
+    reinterpret_cast<InternalMmapVector<uptr> *>(Arg)->push_back(Key);
+  }
+
+  // Drops all MemInfoBlocks accumulated so far. Paired with
+  // __memprof_profile_dump(), this lets long-running processes emit a series
+  // of self-contained profiles: the footprint is then bounded by the number
+  // of unique contexts seen between two dumps rather than growing for the
+  // lifetime of the process. Live blocks are re-inserted by the next dump.
+  void ResetMIBs() {
+    allocator.ForceLock();
+    InternalMmapVector<uptr> Keys;
+    MIBMap.ForEach(CollectKeyCallback, &Keys);
+    for (uptr Key : Keys) {
+      MIBMapTy::Handle h(&MIBMap, Key, /*remove=*/true, /*create=*/false);
+      if (h.exists())
+        InternalFree(*h);
+    }
+    allocator.ForceUnlock();
+  }
+
   // Inserts any blocks which have been allocated but not yet deallocated.
   void InsertLiveBlocks() {
     allocator.ForEachChunk(
@@ -710,3 +733,15 @@ int __memprof_profile_dump() {
   // detected during the dumping process.
   return 0;
 }
+
+void __memprof_profile_reset() {
+  instance.ResetMIBs();
+  // Closing the file descriptor ensures that the next dump reopens the
+  // report path and writes a fresh, self-contained raw profile rather than
+  // appending to the current one.
+  if (report_file.fd != kInvalidFd && report_file.fd != kStdoutFd &&
+      report_file.fd != kStderrFd) {
+    CloseFile(report_file.fd);
+    report_file.fd = kInvalidFd;
+  }
+}
@@ -235,6 +235,10 @@ bool MemoryRangeIsAvailable(uptr range_start, uptr range_end) {
   while (proc_maps.Next(&segment)) {
     if (segment.start == segment.end) continue;  // Empty range.
     CHECK_NE(0, segment.end);
+    // Segments are reported in ascending address order, so once we are past
+    // the range of interest no further segment can intersect it.
+    if (segment.start > range_end)
+      break;
     if (!IntervalsAreSeparate(segment.start, segment.end - 1, range_start,
                               range_end))
       return false;
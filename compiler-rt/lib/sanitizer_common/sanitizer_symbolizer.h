@@ -186,6 +186,10 @@ class Symbolizer final {
   ListOfModules fallback_modules_;
   // If stale, need to reload the modules before looking up addresses.
   bool modules_fresh_;
+  // The module the last lookup resolved to. Frames of one stack trace tend to
+  // come from very few modules, so checking it first skips the linear scan
+  // over the whole module list. Reset whenever the lists are reloaded.
+  const LoadedModule *last_found_module_ = nullptr;
 
   // Platform-specific default demangler, must not return nullptr.
   const char *PlatformDemangle(const char *name);
@@ -185,6 +185,8 @@ void Symbolizer::RefreshModules() {
   modules_.init();
   fallback_modules_.fallbackInit();
   RAW_CHECK(modules_.size() > 0);
+  // Reloading reallocates the lists, so the cached entry is dangling now.
+  last_found_module_ = nullptr;
   modules_fresh_ = true;
 }
 
@@ -204,8 +206,10 @@ const LoadedModule *Symbolizer::FindModuleForAddress(uptr address) {
     RefreshModules();
     modules_were_reloaded = true;
   }
+  if (last_found_module_ && last_found_module_->containsAddress(address))
+    return last_found_module_;
   const LoadedModule *module = SearchForModule(modules_, address);
-  if (module) return module;
+  if (module) return last_found_module_ = module;
 
   // dlopen/dlclose interceptors invalidate the module list, but when
   // interception is disabled, we need to retry if the lookup fails in
@@ -214,12 +218,14 @@ const LoadedModule *Symbolizer::FindModuleForAddress(uptr address) {
   if (!modules_were_reloaded) {
     RefreshModules();
     module = SearchForModule(modules_, address);
-    if (module) return module;
+    if (module) return last_found_module_ = module;
   }
 #endif
 
   if (fallback_modules_.size()) {
     module = SearchForModule(fallback_modules_, address);
+    if (module)
+      last_found_module_ = module;
   }
   return module;
 }
@@ -467,13 +467,21 @@ private:
     }
 
     ReleaseRecorder Recorder(Region->RegionBeg, &Region->Data);
-    const uptr CompactPtrBase = getCompactPtrBaseByClassId(ClassId);
-    auto DecompactPtr = [CompactPtrBase](CompactPtrT CompactPtr) {
-      return decompactPtrInternal(CompactPtrBase, CompactPtr);
-    };
-    auto SkipRegion = [](UNUSED uptr RegionIndex) { return false; };
-    releaseFreeMemoryToOS(Region->FreeList, Region->AllocatedUser, 1U,
-                          BlockSize, &Recorder, DecompactPtr, SkipRegion);
+    if (BytesInFreeList == Region->AllocatedUser) {
+      // Everything carved out of the region is back in the free list, so the
+      // whole allocated range is releasable. Skip building the per-page
+      // counters and release it in a single call.
+      Recorder.releasePageRangeToOS(
+          0, roundUpTo(Region->AllocatedUser, PageSize));
+    } else {
+      const uptr CompactPtrBase = getCompactPtrBaseByClassId(ClassId);
+      auto DecompactPtr = [CompactPtrBase](CompactPtrT CompactPtr) {
+        return decompactPtrInternal(CompactPtrBase, CompactPtr);
+      };
+      auto SkipRegion = [](UNUSED uptr RegionIndex) { return false; };
+      releaseFreeMemoryToOS(Region->FreeList, Region->AllocatedUser, 1U,
+                            BlockSize, &Recorder, DecompactPtr, SkipRegion);
+    }
 
     if (Recorder.getReleasedRangesCount() > 0) {
       Region->ReleaseInfo.PushedBlocksAtLastRelease =
@@ -0,0 +1,31 @@
+// RUN: %clangxx_memprof %s -o %t
+
+// RUN: %env_memprof_opts=print_text=true:log_path=stdout %run %t | FileCheck %s
+
+#include <sanitizer/memprof_interface.h>
+#include <stdlib.h>
+#include <string.h>
+int main(int argc, char **argv) {
+  char *x = (char *)malloc(10);
+  memset(x, 0, 10);
+  free(x);
+  __memprof_profile_dump();
+  __memprof_profile_reset();
+  x = (char *)malloc(10);
+  memset(x, 0, 10);
+  free(x);
+  return 0;
+}
+// We should get 2 rounds of profile info: one from the explicit dump request
+// and one at exit. The reset drops the MIBs recorded before it, so each round
+// contains exactly one allocation stack.
+//
+// CHECK: Recorded MIBs (incl. live on exit):
+// CHECK: Memory allocation stack id = [[STACKID1:[0-9]+]]
+// CHECK-NOT: Memory allocation stack id
+// CHECK: Stack for id [[STACKID1]]
+//
+// CHECK: Recorded MIBs (incl. live on exit):
+// CHECK: Memory allocation stack id = [[STACKID2:[0-9]+]]
+// CHECK-NOT: Memory allocation stack id
+// CHECK: Stack for id [[STACKID2]]
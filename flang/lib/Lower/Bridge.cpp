@@ -614,6 +614,11 @@ public:
   /// Generate a `Location` from the `CharBlock`.
   mlir::Location
   genLocation(const Fortran::parser::CharBlock &block) override final {
+    // Lowering a statement usually creates several operations at the same
+    // source position, so remember the last mapping rather than searching the
+    // cooked source provenance again for each operation.
+    if (lastSourceLocation && block == lastSourcePosition)
+      return *lastSourceLocation;
     if (const Fortran::parser::AllCookedSources *cooked =
             bridge.getCookedSource()) {
       if (std::optional<std::pair<Fortran::parser::SourcePosition,
@@ -621,8 +626,12 @@ public:
               loc = cooked->GetSourcePositionRange(block)) {
         // loc is a pair (begin, end); use the beginning position
         Fortran::parser::SourcePosition &filePos = loc->first;
-        return mlir::FileLineColLoc::get(&getMLIRContext(), filePos.file.path(),
-                                         filePos.line, filePos.column);
+        mlir::Location mlirLoc = mlir::FileLineColLoc::get(
+            &getMLIRContext(), filePos.file.path(), filePos.line,
+            filePos.column);
+        lastSourcePosition = block;
+        lastSourceLocation = mlirLoc;
+        return mlirLoc;
       }
     }
     return genUnknownLocation();
@@ -3272,6 +3281,10 @@ private:
   Fortran::parser::CharBlock currentPosition;
   RuntimeTypeInfoConverter runtimeTypeInfoConverter;
 
+  /// genLocation memo of the most recently translated source position.
+  Fortran::parser::CharBlock lastSourcePosition;
+  std::optional<mlir::Location> lastSourceLocation;
+
   /// WHERE statement/construct mask expression stack.
   Fortran::lower::ImplicitIterSpace implicitIterSpace;
 
@@ -20,6 +20,7 @@
 #include "mlir/Dialect/ControlFlow/IR/ControlFlowOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/Optional.h"
 #include "llvm/Support/Debug.h"
 
 #define DEBUG_TYPE "flang-array-value-copy"
@@ -475,14 +476,14 @@ static bool mutuallyExclusiveSliceRange(ArrayLoadOp ld, ArrayMergeStoreOp st) {
   if (size != stTriples.size())
     return false;
 
-  auto displacedByConstant = [](mlir::Value v1, mlir::Value v2) {
-    auto removeConvert = [](mlir::Value v) -> mlir::Operation * {
-      auto *op = v.getDefiningOp();
-      while (auto conv = mlir::dyn_cast_or_null<ConvertOp>(op))
-        op = conv.getValue().getDefiningOp();
-      return op;
-    };
+  auto removeConvert = [](mlir::Value v) -> mlir::Operation * {
+    auto *op = v.getDefiningOp();
+    while (auto conv = mlir::dyn_cast_or_null<ConvertOp>(op))
+      op = conv.getValue().getDefiningOp();
+    return op;
+  };
 
+  auto displacedByConstant = [&](mlir::Value v1, mlir::Value v2) {
     auto isPositiveConstant = [](mlir::Value v) -> bool {
       if (auto conOp =
               mlir::dyn_cast<mlir::arith::ConstantOp>(v.getDefiningOp()))
@@ -508,6 +509,31 @@ static bool mutuallyExclusiveSliceRange(ArrayLoadOp ld, ArrayMergeStoreOp st) {
     return false;
   };
 
+  // Return the bound as an integer constant, if it is one (modulo conversions).
+  auto constantBound = [&](mlir::Value v) -> llvm::Optional<std::int64_t> {
+    if (auto conOp =
+            mlir::dyn_cast_or_null<mlir::arith::ConstantOp>(removeConvert(v)))
+      if (auto iattr = conOp.getValue().dyn_cast<mlir::IntegerAttr>())
+        return iattr.getInt();
+    return llvm::None;
+  };
+
+  // Are the ranges (lb1:ub1:*) and (lb2:ub2:*) disjoint? Whatever the stride,
+  // the elements a triple accesses all lie between its lower and upper bound,
+  // so the ranges are disjoint if one ends before the other begins. Requires
+  // all four bounds to be integer constants.
+  auto disjointConstantRanges = [&](mlir::Value lb1, mlir::Value ub1,
+                                    mlir::Value lb2, mlir::Value ub2) -> bool {
+    auto l1 = constantBound(lb1);
+    auto u1 = constantBound(ub1);
+    auto l2 = constantBound(lb2);
+    auto u2 = constantBound(ub2);
+    if (!l1 || !u1 || !l2 || !u2)
+      return false;
+    return std::max(*l1, *u1) < std::min(*l2, *u2) ||
+           std::max(*l2, *u2) < std::min(*l1, *u1);
+  };
+
   for (std::remove_const_t<decltype(size)> i = 0; i < size; i += 3) {
     // If both are loop invariant, skip to the next triple.
     if (mlir::isa_and_nonnull<fir::UndefOp>(ldTriples[i + 1].getDefiningOp()) &&
@@ -527,6 +553,11 @@ static bool mutuallyExclusiveSliceRange(ArrayLoadOp ld, ArrayMergeStoreOp st) {
     if (displacedByConstant(ldTriples[i + 1], stTriples[i]) ||
         displacedByConstant(stTriples[i + 1], ldTriples[i]))
       continue;
+    // If the bounds are all constants and the ranges do not intersect, skip to
+    // the next triple.
+    if (disjointConstantRanges(ldTriples[i], ldTriples[i + 1], stTriples[i],
+                               stTriples[i + 1]))
+      continue;
     return false;
   }
   LLVM_DEBUG(llvm::dbgs() << "detected non-overlapping slice ranges on " << ld
@@ -14,6 +14,8 @@
 #include "connection.h"
 #include "environment.h"
 #include "utf.h"
+#include <algorithm>
+#include <cstring>
 
 namespace Fortran::runtime::io {
 
@@ -75,10 +77,17 @@ bool EmitRepeated(CONTEXT &to, char ch, std::size_t n) {
   }
   ConnectionState &connection{to.GetConnectionState()};
   if (connection.internalIoCharKind <= 1) {
-    while (n-- > 0) {
-      if (!to.Emit(&ch, 1)) {
+    // Emit the repeated character in chunks so that blank field padding
+    // does not pay the per-call Emit overhead once per byte.
+    char buffer[64];
+    std::size_t chunk{std::min(n, sizeof buffer)};
+    std::memset(buffer, ch, chunk);
+    while (n > 0) {
+      std::size_t now{std::min(n, chunk)};
+      if (!to.Emit(buffer, now)) {
         return false;
       }
+      n -= now;
     }
   } else {
     while (n-- > 0) {
@@ -179,6 +179,12 @@ struct Accelerator {
   static void copy(char *dst, const char *src, size_t count) {
     asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(count) : : "memory");
   }
+  static void splat_set(char *dst, const unsigned char value, size_t count) {
+    asm volatile("rep stosb"
+                 : "+D"(dst), "+c"(count)
+                 : "a"(value)
+                 : "memory");
+  }
 };
 
 } // namespace x86
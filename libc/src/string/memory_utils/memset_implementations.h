@@ -10,6 +10,7 @@
 #define LLVM_LIBC_SRC_STRING_MEMORY_UTILS_MEMSET_IMPLEMENTATIONS_H
 
 #include "src/__support/architectures.h"
+#include "src/__support/common.h"
 #include "src/string/memory_utils/elements.h"
 #include "src/string/memory_utils/utils.h"
 
@@ -54,6 +55,24 @@ inline static void inline_memset(char *dst, unsigned char value, size_t count) {
   // LLVM_LIBC_ARCH_X86
   /////////////////////////////////////////////////////////////////////////////
   using namespace __llvm_libc::x86;
+
+  // Whether to use only rep;stosb.
+  constexpr bool USE_ONLY_REP_STOSB =
+      LLVM_LIBC_IS_DEFINED(LLVM_LIBC_MEMSET_X86_USE_ONLY_REPSTOSB);
+
+  // kRepStosbSize == -1 : Only vector writes are used.
+  // kRepStosbSize ==  0 : Only RepStosb is used.
+  // else vector writes are used up to kRepStosbSize and then RepStosb.
+  constexpr size_t REP_STOS_B_SIZE =
+#if defined(LLVM_LIBC_MEMSET_X86_USE_REPSTOSB_FROM_SIZE)
+      LLVM_LIBC_MEMSET_X86_USE_REPSTOSB_FROM_SIZE;
+#else
+      -1;
+#endif // LLVM_LIBC_MEMSET_X86_USE_REPSTOSB_FROM_SIZE
+
+  if (USE_ONLY_REP_STOSB)
+    return splat_set<x86::Accelerator>(dst, value, count);
+
   if (count == 0)
     return;
   if (count == 1)
@@ -72,7 +91,9 @@ inline static void inline_memset(char *dst, unsigned char value, size_t count) {
     return splat_set<HeadTail<_32>>(dst, value, count);
   if (count <= 128)
     return splat_set<HeadTail<_64>>(dst, value, count);
-  return splat_set<Align<_32, Arg::Dst>::Then<Loop<_32>>>(dst, value, count);
+  if (count <= REP_STOS_B_SIZE)
+    return splat_set<Align<_32, Arg::Dst>::Then<Loop<_32>>>(dst, value, count);
+  return splat_set<x86::Accelerator>(dst, value, count);
 #elif defined(LLVM_LIBC_ARCH_AARCH64)
   /////////////////////////////////////////////////////////////////////////////
   // LLVM_LIBC_ARCH_AARCH64
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+
+namespace {
+
+// The throw/catch round trip covers __cxa_allocate_exception, the unwinder
+// hand-off and __cxa_free_exception; the payload size shows how allocation
+// cost scales with the thrown object.
+template <std::size_t PayloadSize>
+struct SizedError {
+  char Payload[PayloadSize];
+};
+
+template <std::size_t PayloadSize>
+static void BM_ThrowCatch(benchmark::State& state) {
+  for (auto _ : state) {
+    try {
+      throw SizedError<PayloadSize>();
+    } catch (SizedError<PayloadSize> const& E) {
+      benchmark::DoNotOptimize(&E);
+    }
+  }
+}
+BENCHMARK_TEMPLATE(BM_ThrowCatch, 8);
+BENCHMARK_TEMPLATE(BM_ThrowCatch, 64);
+BENCHMARK_TEMPLATE(BM_ThrowCatch, 1024);
+
+static void BM_ThrowCatchRuntimeError(benchmark::State& state) {
+  for (auto _ : state) {
+    try {
+      throw std::runtime_error("some error happened");
+    } catch (std::runtime_error const& E) {
+      benchmark::DoNotOptimize(&E);
+    }
+  }
+}
+BENCHMARK(BM_ThrowCatchRuntimeError);
+
+static void BM_RethrowExceptionPtr(benchmark::State& state) {
+  std::exception_ptr Ptr = std::make_exception_ptr(std::runtime_error("err"));
+  for (auto _ : state) {
+    try {
+      std::rethrow_exception(Ptr);
+    } catch (std::runtime_error const& E) {
+      benchmark::DoNotOptimize(&E);
+    }
+  }
+}
+BENCHMARK(BM_RethrowExceptionPtr);
+
+} // namespace
+
+BENCHMARK_MAIN();
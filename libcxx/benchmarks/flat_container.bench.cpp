@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Compares a sorted-vector ("flat") map against std::map and
+// std::unordered_map for lookup and bulk construction. This is the baseline
+// data for an eventual std::flat_map implementation: the flat representation
+// should win on lookup for small and medium sizes through cache locality, and
+// on bulk construction through a single sort instead of node allocations.
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace {
+
+// The minimal sorted-vector map the fleet keeps reimplementing by hand:
+// contiguous key/value pairs ordered by key, lookup via lower_bound.
+struct FlatMap {
+  std::vector<std::pair<uint64_t, uint64_t> > Entries;
+
+  void buildFrom(std::vector<std::pair<uint64_t, uint64_t> > Pairs) {
+    std::sort(Pairs.begin(), Pairs.end());
+    Pairs.erase(std::unique(Pairs.begin(), Pairs.end(),
+                            [](const std::pair<uint64_t, uint64_t>& L,
+                               const std::pair<uint64_t, uint64_t>& R) {
+                              return L.first == R.first;
+                            }),
+                Pairs.end());
+    Entries = std::move(Pairs);
+  }
+
+  const uint64_t* find(uint64_t Key) const {
+    auto It = std::lower_bound(Entries.begin(), Entries.end(), Key,
+                               [](const std::pair<uint64_t, uint64_t>& E,
+                                  uint64_t K) { return E.first < K; });
+    if (It == Entries.end() || It->first != Key)
+      return nullptr;
+    return &It->second;
+  }
+};
+
+std::vector<std::pair<uint64_t, uint64_t> > makePairs(size_t Size) {
+  std::vector<std::pair<uint64_t, uint64_t> > Pairs;
+  Pairs.reserve(Size);
+  for (uint64_t I = 0; I < Size; ++I)
+    Pairs.emplace_back(2 * I, I);
+  std::mt19937_64 M(42);
+  std::shuffle(Pairs.begin(), Pairs.end(), M);
+  return Pairs;
+}
+
+// Half the probed keys hit, half fall between entries.
+std::vector<uint64_t> makeProbeKeys(size_t Size) {
+  std::vector<uint64_t> Keys;
+  Keys.reserve(Size);
+  for (uint64_t I = 0; I < Size; ++I)
+    Keys.push_back(2 * I + (I & 1));
+  std::mt19937_64 M(1337);
+  std::shuffle(Keys.begin(), Keys.end(), M);
+  return Keys;
+}
+
+void BM_FlatMapFind(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  FlatMap M;
+  M.buildFrom(makePairs(Size));
+  const std::vector<uint64_t> Keys = makeProbeKeys(Size);
+  while (State.KeepRunningBatch(Keys.size()))
+    for (uint64_t Key : Keys)
+      benchmark::DoNotOptimize(M.find(Key));
+}
+BENCHMARK(BM_FlatMapFind)->Range(16, 1 << 16);
+
+void BM_MapFind(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  const std::vector<std::pair<uint64_t, uint64_t> > Pairs = makePairs(Size);
+  std::map<uint64_t, uint64_t> M(Pairs.begin(), Pairs.end());
+  const std::vector<uint64_t> Keys = makeProbeKeys(Size);
+  while (State.KeepRunningBatch(Keys.size()))
+    for (uint64_t Key : Keys)
+      benchmark::DoNotOptimize(M.find(Key));
+}
+BENCHMARK(BM_MapFind)->Range(16, 1 << 16);
+
+void BM_UnorderedMapFind(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  const std::vector<std::pair<uint64_t, uint64_t> > Pairs = makePairs(Size);
+  std::unordered_map<uint64_t, uint64_t> M(Pairs.begin(), Pairs.end());
+  const std::vector<uint64_t> Keys = makeProbeKeys(Size);
+  while (State.KeepRunningBatch(Keys.size()))
+    for (uint64_t Key : Keys)
+      benchmark::DoNotOptimize(M.find(Key));
+}
+BENCHMARK(BM_UnorderedMapFind)->Range(16, 1 << 16);
+
+void BM_FlatMapBulkBuild(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  const std::vector<std::pair<uint64_t, uint64_t> > Pairs = makePairs(Size);
+  while (State.KeepRunningBatch(Size)) {
+    FlatMap M;
+    M.buildFrom(Pairs);
+    benchmark::DoNotOptimize(M);
+  }
+}
+BENCHMARK(BM_FlatMapBulkBuild)->Range(16, 1 << 16);
+
+void BM_MapBulkBuild(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  const std::vector<std::pair<uint64_t, uint64_t> > Pairs = makePairs(Size);
+  while (State.KeepRunningBatch(Size)) {
+    std::map<uint64_t, uint64_t> M(Pairs.begin(), Pairs.end());
+    benchmark::DoNotOptimize(M);
+  }
+}
+BENCHMARK(BM_MapBulkBuild)->Range(16, 1 << 16);
+
+void BM_UnorderedMapBulkBuild(benchmark::State& State) {
+  const size_t Size = State.range(0);
+  const std::vector<std::pair<uint64_t, uint64_t> > Pairs = makePairs(Size);
+  while (State.KeepRunningBatch(Size)) {
+    std::unordered_map<uint64_t, uint64_t> M(Pairs.begin(), Pairs.end());
+    benchmark::DoNotOptimize(M);
+  }
+}
+BENCHMARK(BM_UnorderedMapBulkBuild)->Range(16, 1 << 16);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -57,6 +57,47 @@ static void BM_StringCtorDefault(benchmark::State &state) {
 }
 BENCHMARK(BM_StringCtorDefault);
 
+// Build a string of the given length one character at a time, exercising the
+// SSO-to-heap transition and the geometric growth policy.
+static void BM_StringAppendChar(benchmark::State& state) {
+  for (auto _ : state) {
+    std::string s;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+      s.push_back('-');
+    benchmark::DoNotOptimize(s);
+  }
+}
+BENCHMARK(BM_StringAppendChar)->Range(8, MAX_STRING_LEN);
+
+// Build a string of the given length by appending small chunks, the common
+// pattern in serializers and log formatting.
+static void BM_StringAppendChunk(benchmark::State& state) {
+  std::string chunk(16, '*');
+  for (auto _ : state) {
+    std::string s;
+    for (std::int64_t sz = 0; sz < state.range(0);
+         sz += static_cast<std::int64_t>(chunk.size()))
+      s.append(chunk);
+    benchmark::DoNotOptimize(s);
+  }
+}
+BENCHMARK(BM_StringAppendChunk)->Range(32, MAX_STRING_LEN);
+
+// Same as BM_StringAppendChunk with the final size reserved up front, to
+// isolate the cost of the growth reallocations.
+static void BM_StringAppendChunkReserved(benchmark::State& state) {
+  std::string chunk(16, '*');
+  for (auto _ : state) {
+    std::string s;
+    s.reserve(static_cast<std::size_t>(state.range(0)));
+    for (std::int64_t sz = 0; sz < state.range(0);
+         sz += static_cast<std::int64_t>(chunk.size()))
+      s.append(chunk);
+    benchmark::DoNotOptimize(s);
+  }
+}
+BENCHMARK(BM_StringAppendChunkReserved)->Range(32, MAX_STRING_LEN);
+
 enum class Length { Empty, Small, Large, Huge };
 struct AllLengths : EnumValuesAsTuple<AllLengths, Length, 4> {
   static constexpr const char* Names[] = {"Empty", "Small", "Large", "Huge"};
@@ -11,6 +11,13 @@
 #define _LIBCPP___ALGORITHM_FIND_H
 
 #include <__config>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/is_volatile.h>
+#include <__type_traits/remove_cv.h>
+#include <cstring>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -27,6 +34,28 @@ find(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
   return __first;
 }
 
+// For contiguous ranges of non-volatile byte-sized integral types (other than
+// bool), equality is equivalent to object representation equality, so we can
+// dispatch to memchr, which is vectorized on all mainstream platforms.
+template <class _Tp,
+          class _Up,
+          __enable_if_t<is_integral<_Tp>::value && sizeof(_Tp) == 1 && !is_volatile<_Tp>::value &&
+                            !is_same<typename remove_cv<_Tp>::type, bool>::value && is_same<typename remove_cv<_Tp>::type, _Up>::value,
+                        int> = 0>
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_SINCE_CXX20 _Tp*
+find(_Tp* __first, _Tp* __last, const _Up& __value) {
+  if (!__libcpp_is_constant_evaluated()) {
+    if (const void* __ret =
+            _VSTD::memchr(__first, static_cast<unsigned char>(__value), static_cast<size_t>(__last - __first)))
+      return const_cast<_Tp*>(static_cast<const _Tp*>(__ret));
+    return __last;
+  }
+  for (; __first != __last; ++__first)
+    if (*__first == __value)
+      break;
+  return __first;
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_FIND_H
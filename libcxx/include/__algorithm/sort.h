@@ -677,6 +677,53 @@ extern template _LIBCPP_FUNC_VIS bool __insertion_sort_incomplete<__less<long do
 
 extern template _LIBCPP_FUNC_VIS unsigned __sort5<__less<long double>&, long double*>(long double*, long double*, long double*, long double*, long double*, __less<long double>&);
 
+// For 1-byte integral keys the whole key space fits in a 256-entry histogram,
+// so large ranges can be sorted by counting occurrences instead of comparing
+// elements. This requires a simple less/greater comparator (anything else could
+// observe an ordering the histogram does not reproduce) and contiguous memory.
+template <class _Compare, class _Iter, class _Tp = typename iterator_traits<_Iter>::value_type>
+using __use_counting_sort =
+    integral_constant<bool, __is_cpp17_contiguous_iterator<_Iter>::value && sizeof(_Tp) == 1 && CHAR_BIT == 8 &&
+                                is_integral<_Tp>::value && __is_simple_comparator<_Compare>::value>;
+
+template <class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI __enable_if_t<__use_counting_sort<_Compare, _RandomAccessIterator>::value, bool>
+__counting_sort_if_profitable(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp) {
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+
+  // The histogram has a fixed cost of roughly two passes over the key space,
+  // so only ranges comfortably larger than it come out ahead of introsort.
+  if (__last - __first <= difference_type(256))
+    return false;
+
+  // The comparator is known to be a less/greater ordering on the value type
+  // (see __is_simple_comparator), so comparing two fixed keys tells us which
+  // direction the output runs.
+  const bool __ascending = __comp(value_type(0), value_type(1));
+
+  // Flipping the sign bit of signed keys makes bucket order match value order.
+  const unsigned char __flip = is_signed<value_type>::value ? 0x80 : 0;
+  size_t __counts[256] = {};
+  for (_RandomAccessIterator __i = __first; __i != __last; ++__i)
+    ++__counts[static_cast<unsigned char>(static_cast<unsigned char>(*__i) ^ __flip)];
+
+  _RandomAccessIterator __out = __first;
+  for (int __i = 0; __i < 256; ++__i) {
+    int __bucket = __ascending ? __i : 255 - __i;
+    value_type __v = static_cast<value_type>(static_cast<unsigned char>(__bucket) ^ __flip);
+    for (size_t __n = __counts[__bucket]; __n > 0; --__n)
+      *__out++ = __v;
+  }
+  return true;
+}
+
+template <class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI __enable_if_t<!__use_counting_sort<_Compare, _RandomAccessIterator>::value, bool>
+__counting_sort_if_profitable(_RandomAccessIterator, _RandomAccessIterator, _Compare) {
+  return false;
+}
+
 template <class _AlgPolicy, class _RandomAccessIterator, class _Comp>
 inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20
 void __sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _Comp& __comp) {
@@ -689,6 +736,9 @@ void __sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _C
   } else {
     using _WrappedComp = typename _WrapAlgPolicy<_AlgPolicy, _Comp_ref>::type;
     _Comp_ref __comp_ref(__comp);
+    if (std::__counting_sort_if_profitable<_Comp_ref>(
+            std::__unwrap_iter(__first), std::__unwrap_iter(__last), __comp_ref))
+      return;
     _WrappedComp __wrapped_comp(__comp_ref);
     std::__sort<_WrappedComp>(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __wrapped_comp);
   }
@@ -192,7 +192,11 @@ void *__cxa_allocate_exception(size_t thrown_size) throw() {
         std::terminate();
     __cxa_exception *exception_header =
         static_cast<__cxa_exception *>((void *)(raw_buffer + header_offset));
-    ::memset(exception_header, 0, actual_size);
+    // Only the header needs to start out zeroed. The thrown object is
+    // constructed into the buffer by the throw expression before anything
+    // reads it, so zeroing it too would just add a thrown_size memset to
+    // every throw.
+    ::memset(exception_header, 0, sizeof(__cxa_exception));
     return thrown_object_from_cxa_exception(exception_header);
 }
 
@@ -2521,6 +2521,15 @@ void UnwindCursor<A, R>::setInfoBasedOnIPRegister(bool isReturnAddress) {
     --pc;
 #endif
 
+  // If the pc is still within the function the last lookup resolved, the
+  // unwind info is unchanged: everything in _info is a function of the
+  // enclosing function, not of the exact pc. This turns the per-frame
+  // section search and FDE lookup into a range check for deeply recursive
+  // stacks, where consecutive frames share one FDE.
+  if (!_unwindInfoMissing && _info.start_ip != 0 && pc >= _info.start_ip &&
+      pc < _info.end_ip)
+    return;
+
   // Ask address space object to find unwind sections for this pc.
   UnwindInfoSections sects;
   if (_addressSpace.findUnwindSections(pc, sects)) {
@@ -54,6 +54,7 @@
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FormatAdapters.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ScopedPrinter.h"
 #include <memory>
@@ -282,13 +283,20 @@ static void addTypeInfo(pdb::TpiStreamBuilder &tpiBuilder,
   // Start the TPI or IPI stream header.
   tpiBuilder.setVersionHeader(pdb::PdbTpiV80);
 
-  // Flatten the in memory type table and hash each type.
-  typeTable.ForEachRecord([&](TypeIndex ti, const CVType &type) {
-    auto hash = pdb::hashTypeRecord(type);
+  // Flatten the in memory type table, then hash the records in parallel;
+  // the stream builder itself must be fed in index order.
+  std::vector<CVType> types;
+  typeTable.ForEachRecord(
+      [&](TypeIndex ti, const CVType &type) { types.push_back(type); });
+  std::vector<uint32_t> hashes(types.size());
+  parallelFor(0, types.size(), [&](size_t i) {
+    auto hash = pdb::hashTypeRecord(types[i]);
     if (auto e = hash.takeError())
       fatal("type hashing error");
-    tpiBuilder.addTypeRecord(type.RecordData, *hash);
+    hashes[i] = *hash;
   });
+  for (size_t i = 0, e = types.size(); i != e; ++i)
+    tpiBuilder.addTypeRecord(types[i].RecordData, hashes[i]);
 }
 
 static void addGHashTypeInfo(COFFLinkerContext &ctx,
@@ -51,6 +51,9 @@ enum class BsymbolicKind { None, NonWeakFunctions, Functions, All };
 // For --build-id.
 enum class BuildIdKind { None, Fast, Md5, Sha1, Hexstring, Uuid };
 
+// For --compress-debug-sections={none,zlib,zstd}.
+enum class DebugCompressionKind { None, Zlib, Zstd };
+
 // For --discard-{all,locals,none}.
 enum class DiscardPolicy { Default, All, Locals, None };
 
@@ -164,7 +167,7 @@ struct Configuration {
   bool callGraphProfileSort;
   bool checkSections;
   bool checkDynamicRelocs;
-  bool compressDebugSections;
+  DebugCompressionKind compressDebugSections;
   bool cref;
   llvm::SmallVector<std::pair<llvm::GlobPattern, uint64_t>, 0>
       deadRelocInNonAlloc;
@@ -400,6 +403,9 @@ struct Ctx {
   llvm::DenseMap<const Symbol *,
                  std::pair<const InputFile *, const InputFile *>>
       backwardReferences;
+  // Whether a given (sysroot-resolved) -L directory exists. Used to skip
+  // probing for files in directories that are absent on the host.
+  llvm::StringMap<bool> searchDirExists;
 };
 
 // The only instance of Ctx struct.
@@ -210,10 +210,21 @@ std::string elf::createResponseFile(const opt::InputArgList &args) {
 static Optional<std::string> findFile(StringRef path1, const Twine &path2) {
   SmallString<128> s;
   if (path1.startswith("="))
-    path::append(s, config->sysroot, path1.substr(1), path2);
+    path::append(s, config->sysroot, path1.substr(1));
   else
-    path::append(s, path1, path2);
+    path::append(s, path1);
 
+  // Linker invocations commonly pass -L directories that do not exist on the
+  // host, and every -l probes each of them for several candidate file names.
+  // Remember per directory whether it exists, so that an absent directory
+  // costs one stat() for the whole link rather than one per probed file.
+  auto it = ctx->searchDirExists.try_emplace(s);
+  if (it.second)
+    it.first->second = fs::is_directory(s);
+  if (!it.first->second)
+    return None;
+
+  path::append(s, path2);
   if (fs::exists(s))
     return std::string(s);
   return None;
@@ -241,6 +241,10 @@ protected:
   // compressed in the first place, or because we ended up uncompressing it).
   // Since the feature is not used often, this is usually -1.
   mutable int64_t uncompressedSize = -1;
+
+  // The ch_type of the compressed section (ELFCOMPRESS_ZLIB or
+  // ELFCOMPRESS_ZSTD). Meaningful only while uncompressedSize >= 0.
+  uint32_t compressedType = 0;
 };
 
 // SectionPiece represents a piece of splittable section contents.
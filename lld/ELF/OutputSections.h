@@ -21,8 +21,9 @@ struct PhdrEntry;
 
 struct CompressedData {
   std::unique_ptr<SmallVector<uint8_t, 0>[]> shards;
+  uint32_t type = 0; // ELFCOMPRESS_ZLIB or ELFCOMPRESS_ZSTD
   uint32_t numShards = 0;
-  uint32_t checksum = 0;
+  uint32_t checksum = 0; // Adler-32; only used by ELFCOMPRESS_ZLIB
   uint64_t uncompressedSize;
 };
 
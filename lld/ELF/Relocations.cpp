@@ -1516,7 +1516,7 @@ void RelocationScanner::scan(ArrayRef<RelTy> rels) {
                       });
 }
 
-template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
+template <class ELFT> static void scanSection(InputSectionBase &s) {
   RelocationScanner scanner(s);
   const RelsOrRelas<ELFT> rels = s.template relsOrRelas<ELFT>();
   if (rels.areRelocsRel())
@@ -1525,6 +1525,31 @@ template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
     scanner.template scan<ELFT>(rels.relas);
 }
 
+template <class ELFT> void elf::scanRelocations() {
+  // Scan all relocations. Each relocation goes through a series of tests to
+  // determine if it needs special treatment, such as creating GOT, PLT or
+  // copy relocations. Note that relocations for non-alloc sections are
+  // directly processed by InputSection::relocateNonAlloc.
+  //
+  // The scan stays on one thread: before sections can be handed out to
+  // tasks, the symbol flag bits set here would have to become atomic, the
+  // dynamic relocation vectors would need per-thread staging, and the global
+  // state used by the MIPS GOT and the PPC64 TOC relaxation would need
+  // special treatment. Keeping the whole walk here, out of the Writer, keeps
+  // that decomposition local to this file.
+  for (InputSectionBase *sec : inputSections)
+    if (sec->isLive() && (sec->flags & SHF_ALLOC))
+      scanSection<ELFT>(*sec);
+
+  for (Partition &part : partitions) {
+    for (EhInputSection *sec : part.ehFrame->sections)
+      scanSection<ELFT>(*sec);
+    if (part.armExidx && part.armExidx->isLive())
+      for (InputSection *sec : part.armExidx->exidxSections)
+        scanSection<ELFT>(*sec);
+  }
+}
+
 static bool handleNonPreemptibleIfunc(Symbol &sym) {
   // Handle a reference to a non-preemptible ifunc. These are special in a
   // few ways:
@@ -2232,7 +2257,7 @@ void elf::hexagonTLSSymbolUpdate(ArrayRef<OutputSection *> outputSections) {
       });
 }
 
-template void elf::scanRelocations<ELF32LE>(InputSectionBase &);
-template void elf::scanRelocations<ELF32BE>(InputSectionBase &);
-template void elf::scanRelocations<ELF64LE>(InputSectionBase &);
-template void elf::scanRelocations<ELF64BE>(InputSectionBase &);
+template void elf::scanRelocations<ELF32LE>();
+template void elf::scanRelocations<ELF32BE>();
+template void elf::scanRelocations<ELF64LE>();
+template void elf::scanRelocations<ELF64BE>();
@@ -1273,10 +1273,14 @@ static DenseMap<const InputSectionBase *, int> buildSectionOrder() {
     }
   };
 
-  // We want both global and local symbols. We get the global ones from the
-  // symbol table and iterate the object files for the local ones.
-  for (Symbol *sym : symtab->getSymbols())
-    addSym(*sym);
+  // We want both global and local symbols. Look the global ones up by name:
+  // the ordering file is normally much smaller than the symbol table, so this
+  // avoids hashing the name of every global symbol in the link. Local symbols
+  // are not in the symbol table, so we still iterate the object files for
+  // those.
+  for (StringRef s : config->symbolOrderingFile)
+    if (Symbol *sym = symtab->find(s))
+      addSym(*sym);
 
   for (ELFFileBase *file : ctx->objectFiles)
     for (Symbol *sym : file->getLocalSymbols())
@@ -1908,21 +1912,7 @@ template <class ELFT> void Writer<ELFT>::finalizeSections() {
     // a linker-script-defined symbol is absolute.
     ppc64noTocRelax.clear();
     if (!config->relocatable) {
-      // Scan all relocations. Each relocation goes through a series of tests to
-      // determine if it needs special treatment, such as creating GOT, PLT,
-      // copy relocations, etc. Note that relocations for non-alloc sections are
-      // directly processed by InputSection::relocateNonAlloc.
-      for (InputSectionBase *sec : inputSections)
-        if (sec->isLive() && (sec->flags & SHF_ALLOC))
-          scanRelocations<ELFT>(*sec);
-      for (Partition &part : partitions) {
-        for (EhInputSection *sec : part.ehFrame->sections)
-          scanRelocations<ELFT>(*sec);
-        if (part.armExidx && part.armExidx->isLive())
-          for (InputSection *sec : part.armExidx->exidxSections)
-            scanRelocations<ELFT>(*sec);
-      }
-
+      scanRelocations<ELFT>();
       reportUndefinedSymbols();
       postScanRelocations();
     }
@@ -15,6 +15,7 @@
 #include "Target.h"
 #include "lld/Common/CommonLinkerContext.h"
 #include "llvm/BinaryFormat/MachO.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/ScopedPrinter.h"
 #include "llvm/Support/TimeProfiler.h"
 
@@ -357,25 +358,22 @@ void TextOutputSection::finalize() {
 }
 
 void ConcatOutputSection::writeTo(uint8_t *buf) const {
-  for (ConcatInputSection *isec : inputs)
+  // Each input section occupies a disjoint slice of the output, so they can
+  // be copied and relocated concurrently.
+  parallelForEach(inputs, [&](ConcatInputSection *isec) {
     isec->writeTo(buf + isec->outSecOff);
+  });
 }
 
 void TextOutputSection::writeTo(uint8_t *buf) const {
-  // Merge input sections from thunk & ordinary vectors
-  size_t i = 0, ie = inputs.size();
-  size_t t = 0, te = thunks.size();
-  while (i < ie || t < te) {
-    while (i < ie && (t == te || inputs[i]->empty() ||
-                      inputs[i]->outSecOff < thunks[t]->outSecOff)) {
-      inputs[i]->writeTo(buf + inputs[i]->outSecOff);
-      ++i;
-    }
-    while (t < te && (i == ie || thunks[t]->outSecOff < inputs[i]->outSecOff)) {
-      thunks[t]->writeTo(buf + thunks[t]->outSecOff);
-      ++t;
-    }
-  }
+  // Input sections and thunks were assigned disjoint address ranges during
+  // finalization, so relative order of the writes doesn't matter.
+  parallelForEach(inputs, [&](ConcatInputSection *isec) {
+    isec->writeTo(buf + isec->outSecOff);
+  });
+  parallelForEach(thunks, [&](ConcatInputSection *thunk) {
+    thunk->writeTo(buf + thunk->outSecOff);
+  });
 }
 
 void ConcatOutputSection::finalizeFlags(InputSection *input) {
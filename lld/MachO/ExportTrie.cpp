@@ -42,6 +42,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/BinaryFormat/MachO.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/Parallel.h"
 
 using namespace llvm;
 using namespace lld;
@@ -145,13 +146,8 @@ void TrieNode::writeTo(uint8_t *buf) const {
   }
 }
 
-TrieBuilder::~TrieBuilder() {
-  for (TrieNode *node : nodes)
-    delete node;
-}
-
 TrieNode *TrieBuilder::makeNode() {
-  auto *node = new TrieNode();
+  auto *node = make<TrieNode>();
   nodes.emplace_back(node);
   return node;
 }
@@ -244,8 +240,9 @@ size_t TrieBuilder::build() {
 }
 
 void TrieBuilder::writeTo(uint8_t *buf) const {
-  for (TrieNode *node : nodes)
-    node->writeTo(buf);
+  // Each node writes to its own (disjoint) slice at buf + node->offset.
+  parallelForEach(nodes,
+                  [buf](const TrieNode *node) { node->writeTo(buf); });
 }
 
 namespace {
@@ -1101,13 +1101,14 @@ void Writer::openFile() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  std::vector<const OutputSection *> osecs;
-  for (const OutputSegment *seg : outputSegments)
-    append_range(osecs, seg->getSections());
 
-  parallelForEach(osecs.begin(), osecs.end(), [&](const OutputSection *osec) {
-    osec->writeTo(buf + osec->fileOff);
-  });
+  // Write the sections one at a time: writeTo implementations parallelize
+  // internally (ConcatOutputSection over its input sections, several
+  // synthetic sections over their entries), which already keeps the shared
+  // pool busy for a monolithic __text -- usually the bulk of the output.
+  for (const OutputSegment *seg : outputSegments)
+    for (const OutputSection *osec : seg->getSections())
+      osec->writeTo(buf + osec->fileOff);
 }
 
 // In order to utilize multiple cores, we first split the buffer into chunks,
@@ -29,7 +29,6 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/LEB128.h"
-#include "llvm/Support/Parallel.h"
 
 #include <cstdarg>
 #include <map>
@@ -211,10 +210,14 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // Write sections in order; the chunk-heavy sections parallelize over their
+  // input chunks internally, which keeps the pool busy where the bytes
+  // actually are.  Parallelizing over the handful of output sections as well
+  // would buy nothing.
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
     s->writeTo(buf);
-  });
+  }
 }
 
 static void setGlobalPtr(DefinedGlobal *g, uint64_t memoryPtr) {
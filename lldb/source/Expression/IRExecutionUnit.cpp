@@ -6,6 +6,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ExecutionEngine/ExecutionEngine.h"
 #include "llvm/ExecutionEngine/ObjectCache.h"
 #include "llvm/IR/Constants.h"
@@ -890,6 +892,16 @@ lldb::addr_t IRExecutionUnit::FindSymbol(lldb_private::ConstString name,
 
   CollectCandidateCPlusPlusNames(candidate_CPlusPlus_names, candidate_C_names,
                                  m_sym_ctx);
+
+  // The C++ fallbacks often reproduce names we already searched above (the
+  // demangled base name of an unmangled name is the name itself), and every
+  // entry costs a target-wide search, so weed out repeats before looking.
+  llvm::DenseSet<ConstString> searched_names(candidate_C_names.begin(),
+                                             candidate_C_names.end());
+  llvm::erase_if(candidate_CPlusPlus_names, [&](ConstString candidate) {
+    return !searched_names.insert(candidate).second;
+  });
+
   ret = FindInSymbols(candidate_CPlusPlus_names, m_sym_ctx, missing_weak);
   return ret;
 }
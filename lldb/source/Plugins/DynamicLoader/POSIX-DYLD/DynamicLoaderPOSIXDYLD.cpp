@@ -430,6 +430,16 @@ void DynamicLoaderPOSIXDYLD::RefreshModules() {
       E = m_rendezvous.end();
       m_initial_modules_added = true;
     }
+    // Fetch the module specs for all modules in one batch up front, the same
+    // way LoadAllCurrentModules does. On remote targets this turns one
+    // round-trip per module into a single qModulesInfo packet, which
+    // dominates the time to the first rendezvous stop on processes with many
+    // shared libraries.
+    std::vector<FileSpec> module_names;
+    for (DYLDRendezvous::iterator J = I; J != E; ++J)
+      module_names.push_back(J->file_spec);
+    m_process->PrefetchModuleSpecs(
+        module_names, m_process->GetTarget().GetArchitecture().GetTriple());
     for (; I != E; ++I) {
       ModuleSP module_sp =
           LoadModuleAtAddress(I->file_spec, I->link_addr, I->base_addr, true);
@@ -117,6 +117,12 @@ void ManualDWARFIndex::Index() {
 
   auto finalize_fn = [this, &sets, &progress](NameToDIE(IndexSet::*index)) {
     NameToDIE &result = m_set.*index;
+    // Reserve the final size up front so the merge doesn't reallocate the
+    // map once per unit.
+    size_t size = 0;
+    for (auto &set : sets)
+      size += (set.*index).GetSize();
+    result.Reserve(size);
     for (auto &set : sets)
       result.Append(set.*index);
     result.Finalize();
@@ -84,6 +84,12 @@ public:
 
   bool IsEmpty() const { return m_map.IsEmpty(); }
 
+  size_t GetSize() const { return m_map.GetSize(); }
+
+  /// Reserve memory for at least \a size entries. Useful before bulk
+  /// Append() calls to avoid reallocating the map repeatedly.
+  void Reserve(size_t size) { m_map.Reserve(size); }
+
   void Clear() { m_map.Clear(); }
 
 protected:
@@ -0,0 +1,61 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/APInt.h"
+
+using namespace llvm;
+
+// 64 bits covers the single-word fast paths that dominate constant folding;
+// 128 and 512 bits exercise the multi-word slow paths used by _BitInt and
+// wide vector constants.
+
+static APInt makeValue(unsigned Bits, uint64_t Seed) {
+  APInt V(Bits, Seed);
+  // Spread bits across all words so multi-word paths do real work.
+  for (unsigned I = 64; I < Bits; I += 64)
+    V |= APInt(Bits, Seed * (I / 64 + 1)).shl(I);
+  return V;
+}
+
+static void BM_APIntAdd(benchmark::State &State) {
+  const unsigned Bits = State.range(0);
+  APInt A = makeValue(Bits, 0x12345678deadbeefULL);
+  APInt B = makeValue(Bits, 0x0f0f0f0f0f0f0f0fULL);
+  for (auto _ : State) {
+    APInt C = A + B;
+    benchmark::DoNotOptimize(C);
+  }
+}
+BENCHMARK(BM_APIntAdd)->Arg(64)->Arg(128)->Arg(512);
+
+static void BM_APIntMul(benchmark::State &State) {
+  const unsigned Bits = State.range(0);
+  APInt A = makeValue(Bits, 0x12345678deadbeefULL);
+  APInt B = makeValue(Bits, 0x0f0f0f0f0f0f0f0fULL);
+  for (auto _ : State) {
+    APInt C = A * B;
+    benchmark::DoNotOptimize(C);
+  }
+}
+BENCHMARK(BM_APIntMul)->Arg(64)->Arg(128)->Arg(512);
+
+static void BM_APIntUDiv(benchmark::State &State) {
+  const unsigned Bits = State.range(0);
+  APInt A = makeValue(Bits, 0x12345678deadbeefULL);
+  APInt B = makeValue(Bits, 0x9e3779b97f4a7c15ULL);
+  for (auto _ : State) {
+    APInt C = A.udiv(B);
+    benchmark::DoNotOptimize(C);
+  }
+}
+BENCHMARK(BM_APIntUDiv)->Arg(64)->Arg(128)->Arg(512);
+
+static void BM_APIntLShr(benchmark::State &State) {
+  const unsigned Bits = State.range(0);
+  APInt A = makeValue(Bits, 0x12345678deadbeefULL);
+  for (auto _ : State) {
+    APInt C = A.lshr(Bits / 3);
+    benchmark::DoNotOptimize(C);
+  }
+}
+BENCHMARK(BM_APIntLShr)->Arg(64)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/FoldingSet.h"
+
+#include <memory>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+
+// A node shaped like the typical uniqued IR object: a couple of words of
+// payload folded into the profile.
+struct TestNode : FoldingSetNode {
+  unsigned Kind;
+  void *Operand;
+
+  TestNode(unsigned Kind, void *Operand) : Kind(Kind), Operand(Operand) {}
+
+  void Profile(FoldingSetNodeID &ID) const {
+    ID.AddInteger(Kind);
+    ID.AddPointer(Operand);
+  }
+};
+
+} // end anonymous namespace
+
+static void BM_FoldingSetInsert(benchmark::State &State) {
+  const unsigned N = State.range(0);
+  std::vector<std::unique_ptr<TestNode>> Nodes;
+  Nodes.reserve(N);
+  for (unsigned I = 0; I != N; ++I)
+    Nodes.push_back(std::make_unique<TestNode>(
+        I % 64, reinterpret_cast<void *>(uintptr_t(I) * 16)));
+  for (auto _ : State) {
+    FoldingSet<TestNode> Set;
+    for (auto &Node : Nodes) {
+      FoldingSetNodeID ID;
+      Node->Profile(ID);
+      void *InsertPos;
+      if (!Set.FindNodeOrInsertPos(ID, InsertPos))
+        Set.InsertNode(Node.get(), InsertPos);
+    }
+    benchmark::DoNotOptimize(Set.size());
+  }
+  State.SetItemsProcessed(State.iterations() * N);
+}
+BENCHMARK(BM_FoldingSetInsert)->Arg(64)->Arg(4096);
+
+// The common uniquing pattern is a hit: the node already exists and
+// FindNodeOrInsertPos returns it.
+static void BM_FoldingSetLookupHit(benchmark::State &State) {
+  const unsigned N = State.range(0);
+  std::vector<std::unique_ptr<TestNode>> Nodes;
+  Nodes.reserve(N);
+  FoldingSet<TestNode> Set;
+  for (unsigned I = 0; I != N; ++I) {
+    Nodes.push_back(std::make_unique<TestNode>(
+        I % 64, reinterpret_cast<void *>(uintptr_t(I) * 16)));
+    FoldingSetNodeID ID;
+    Nodes.back()->Profile(ID);
+    void *InsertPos;
+    Set.FindNodeOrInsertPos(ID, InsertPos);
+    Set.InsertNode(Nodes.back().get(), InsertPos);
+  }
+  for (auto _ : State) {
+    unsigned Found = 0;
+    for (auto &Node : Nodes) {
+      FoldingSetNodeID ID;
+      Node->Profile(ID);
+      void *InsertPos;
+      Found += Set.FindNodeOrInsertPos(ID, InsertPos) != nullptr;
+    }
+    benchmark::DoNotOptimize(Found);
+  }
+  State.SetItemsProcessed(State.iterations() * N);
+}
+BENCHMARK(BM_FoldingSetLookupHit)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/StringMap.h"
+
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Generate keys shaped like mangled C++ symbol names, which dominate the
+// StringMap workloads in linkers and frontends (~tens to hundreds of bytes).
+static std::vector<std::string> makeKeys(size_t N, size_t Len) {
+  std::vector<std::string> Keys;
+  Keys.reserve(N);
+  for (size_t I = 0; I != N; ++I) {
+    std::string K = "_ZN4test" + std::to_string(I) + "E";
+    while (K.size() < Len)
+      K += "abcdefgh";
+    K.resize(Len);
+    Keys.push_back(std::move(K));
+  }
+  return Keys;
+}
+
+static void BM_StringMapHash(benchmark::State &State) {
+  std::vector<std::string> Keys = makeKeys(1024, State.range(0));
+  for (auto _ : State) {
+    uint32_t H = 0;
+    for (const std::string &K : Keys)
+      H ^= StringMapImpl::hash(K);
+    benchmark::DoNotOptimize(H);
+  }
+  State.SetBytesProcessed(State.iterations() * Keys.size() * State.range(0));
+}
+BENCHMARK(BM_StringMapHash)->Arg(8)->Arg(32)->Arg(180)->Arg(512);
+
+static void BM_StringMapInsertLookup(benchmark::State &State) {
+  std::vector<std::string> Keys = makeKeys(4096, State.range(0));
+  for (auto _ : State) {
+    StringMap<unsigned> Map;
+    for (const std::string &K : Keys)
+      Map[K] = 1;
+    unsigned Found = 0;
+    for (const std::string &K : Keys)
+      Found += Map.count(K);
+    benchmark::DoNotOptimize(Found);
+  }
+}
+BENCHMARK(BM_StringMapInsertLookup)->Arg(8)->Arg(32)->Arg(180);
+
+BENCHMARK_MAIN();
@@ -143,13 +143,11 @@ public:
 
   /// Return 1 if the specified key is in the map, 0 otherwise.
   size_type count(const_arg_type_t<KeyT> Val) const {
-    const BucketT *TheBucket;
-    return LookupBucketFor(Val, TheBucket) ? 1 : 0;
+    return doFind(Val) ? 1 : 0;
   }
 
   iterator find(const_arg_type_t<KeyT> Val) {
-    BucketT *TheBucket;
-    if (LookupBucketFor(Val, TheBucket))
+    if (BucketT *TheBucket = doFind(Val))
       return makeIterator(TheBucket,
                           shouldReverseIterate<KeyT>() ? getBuckets()
                                                        : getBucketsEnd(),
@@ -157,8 +155,7 @@ public:
     return end();
   }
   const_iterator find(const_arg_type_t<KeyT> Val) const {
-    const BucketT *TheBucket;
-    if (LookupBucketFor(Val, TheBucket))
+    if (const BucketT *TheBucket = doFind(Val))
       return makeConstIterator(TheBucket,
                                shouldReverseIterate<KeyT>() ? getBuckets()
                                                             : getBucketsEnd(),
@@ -173,8 +170,7 @@ public:
   /// type used.
   template<class LookupKeyT>
   iterator find_as(const LookupKeyT &Val) {
-    BucketT *TheBucket;
-    if (LookupBucketFor(Val, TheBucket))
+    if (BucketT *TheBucket = doFind(Val))
       return makeIterator(TheBucket,
                           shouldReverseIterate<KeyT>() ? getBuckets()
                                                        : getBucketsEnd(),
@@ -183,8 +179,7 @@ public:
   }
   template<class LookupKeyT>
   const_iterator find_as(const LookupKeyT &Val) const {
-    const BucketT *TheBucket;
-    if (LookupBucketFor(Val, TheBucket))
+    if (const BucketT *TheBucket = doFind(Val))
       return makeConstIterator(TheBucket,
                                shouldReverseIterate<KeyT>() ? getBuckets()
                                                             : getBucketsEnd(),
@@ -195,8 +190,7 @@ public:
   /// lookup - Return the entry for the specified key, or a default
   /// constructed value if no such entry exists.
   ValueT lookup(const_arg_type_t<KeyT> Val) const {
-    const BucketT *TheBucket;
-    if (LookupBucketFor(Val, TheBucket))
+    if (const BucketT *TheBucket = doFind(Val))
       return TheBucket->getSecond();
     return ValueT();
   }
@@ -300,8 +294,8 @@ public:
   }
 
   bool erase(const KeyT &Val) {
-    BucketT *TheBucket;
-    if (!LookupBucketFor(Val, TheBucket))
+    BucketT *TheBucket = doFind(Val);
+    if (!TheBucket)
       return false; // not in map.
 
     TheBucket->getSecond().~ValueT();
@@ -600,6 +594,40 @@ private:
     return TheBucket;
   }
 
+  /// Probe for the bucket containing Val, or return null if Val is not in the
+  /// map.  Unlike LookupBucketFor, this is for read-only operations: it does
+  /// not track the first tombstone seen, since no insertion will reuse it,
+  /// which keeps the probe loop down to two key comparisons per step.
+  template <typename LookupKeyT>
+  const BucketT *doFind(const LookupKeyT &Val) const {
+    const BucketT *BucketsPtr = getBuckets();
+    const unsigned NumBuckets = getNumBuckets();
+    if (NumBuckets == 0)
+      return nullptr;
+
+    const KeyT EmptyKey = getEmptyKey();
+    unsigned BucketNo = getHashValue(Val) & (NumBuckets - 1);
+    unsigned ProbeAmt = 1;
+    while (true) {
+      const BucketT *Bucket = BucketsPtr + BucketNo;
+      if (LLVM_LIKELY(KeyInfoT::isEqual(Val, Bucket->getFirst())))
+        return Bucket;
+      if (LLVM_LIKELY(KeyInfoT::isEqual(Bucket->getFirst(), EmptyKey)))
+        return nullptr;
+
+      // Otherwise, it's a hash collision or a tombstone, continue quadratic
+      // probing.
+      BucketNo += ProbeAmt++;
+      BucketNo &= NumBuckets - 1;
+    }
+  }
+
+  template <typename LookupKeyT>
+  BucketT *doFind(const LookupKeyT &Val) {
+    return const_cast<BucketT *>(
+        const_cast<const DenseMapBase *>(this)->doFind(Val));
+  }
+
   /// LookupBucketFor - Lookup the appropriate bucket for Val, returning it in
   /// FoundBucket.  If the bucket contains the key and a value, this returns
   /// true, otherwise it returns a bucket with an empty marker or tombstone and
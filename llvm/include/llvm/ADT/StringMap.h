@@ -91,6 +91,10 @@ public:
   unsigned getNumBuckets() const { return NumBuckets; }
   unsigned getNumItems() const { return NumItems; }
 
+  /// Returns the hash value StringMap uses for \p Key. Callers that batch
+  /// lookups can use this to precompute hashes off the critical path.
+  static uint32_t hash(StringRef Key);
+
   bool empty() const { return NumItems == 0; }
   unsigned size() const { return NumItems; }
 
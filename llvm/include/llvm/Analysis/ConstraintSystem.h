@@ -12,6 +12,7 @@
 #include "llvm/ADT/APInt.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/MathExtras.h"
 
 #include <string>
 
@@ -44,9 +45,10 @@ public:
       return false;
 
     for (const auto &C : R) {
-      auto A = std::abs(C);
-      GCD = APIntOps::GreatestCommonDivisor({32, (uint32_t)A}, {32, GCD})
-                .getZExtValue();
+      // gcd(0, GCD) == GCD, so zero coefficients cannot change it.
+      if (C == 0)
+        continue;
+      GCD = (uint32_t)GreatestCommonDivisor64((uint32_t)std::abs(C), GCD);
     }
     Constraints.emplace_back(R.begin(), R.end());
     return true;
@@ -564,7 +564,11 @@ public:
   const SCEV *getPtrToIntExpr(const SCEV *Op, Type *Ty);
   const SCEV *getTruncateExpr(const SCEV *Op, Type *Ty, unsigned Depth = 0);
   const SCEV *getZeroExtendExpr(const SCEV *Op, Type *Ty, unsigned Depth = 0);
+  const SCEV *getZeroExtendExprImpl(const SCEV *Op, Type *Ty,
+                                    unsigned Depth = 0);
   const SCEV *getSignExtendExpr(const SCEV *Op, Type *Ty, unsigned Depth = 0);
+  const SCEV *getSignExtendExprImpl(const SCEV *Op, Type *Ty,
+                                    unsigned Depth = 0);
   const SCEV *getCastExpr(SCEVTypes Kind, const SCEV *Op, Type *Ty);
   const SCEV *getAnyExtendExpr(const SCEV *Op, Type *Ty);
   const SCEV *getAddExpr(SmallVectorImpl<const SCEV *> &Ops,
@@ -2109,6 +2113,26 @@ private:
   FoldingSet<SCEVPredicate> UniquePreds;
   BumpPtrAllocator SCEVAllocator;
 
+  /// Key for memoized folds: the SCEV type of the fold (as unsigned, since
+  /// DenseMapInfo has no enum support), the operand and the destination type.
+  using FoldID = std::tuple<unsigned, const SCEV *, Type *>;
+
+  /// Cache the results of extension folds. getZeroExtendExpr and
+  /// getSignExtendExpr may perform expensive no-wrap reasoning before
+  /// producing a simplified expression; repeated queries for the same operand
+  /// and type (common when many cloned loops share trip-count structure) hit
+  /// this cache instead.
+  DenseMap<FoldID, const SCEV *> FoldCache;
+
+  /// Reverse map of \c FoldCache: for each cached SCEV result, the keys of
+  /// the entries producing it. Used to invalidate the cache in
+  /// forgetMemoizedResults().
+  DenseMap<const SCEV *, SmallVector<FoldID, 2>> FoldCacheUser;
+
+  /// Insert (or replace) the \c FoldCache entry for \p ID with \p S, keeping
+  /// \c FoldCacheUser in sync.
+  void insertFoldCacheEntry(const FoldID &ID, const SCEV *S);
+
   /// This maps loops to a list of addrecs that directly use said loop.
   DenseMap<const Loop *, SmallVector<const SCEVAddRecExpr *, 4>> LoopUsers;
 
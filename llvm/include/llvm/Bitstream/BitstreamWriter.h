@@ -362,6 +362,33 @@ private:
     }
   }
 
+  /// EmitAbbreviatedArray - Emit a sequence of values that all use the same
+  /// element encoding.  Dispatching on the encoding once per array rather than
+  /// once per element matters for the hot array forms: Char6 arrays (symbol
+  /// names) and fixed-width byte arrays dominate bitcode writing time.
+  template <typename uintty>
+  void EmitAbbreviatedArray(const BitCodeAbbrevOp &EltEnc,
+                            ArrayRef<uintty> Vals) {
+    assert(!EltEnc.isLiteral() && "Not an encoding");
+    switch (EltEnc.getEncoding()) {
+    default: llvm_unreachable("Unknown encoding!");
+    case BitCodeAbbrevOp::Fixed:
+      if (unsigned BitWidth = EltEnc.getEncodingData())
+        for (uintty V : Vals)
+          Emit((unsigned)V, BitWidth);
+      break;
+    case BitCodeAbbrevOp::VBR:
+      if (unsigned BitWidth = EltEnc.getEncodingData())
+        for (uintty V : Vals)
+          EmitVBR64(V, BitWidth);
+      break;
+    case BitCodeAbbrevOp::Char6:
+      for (uintty V : Vals)
+        Emit(BitCodeAbbrevOp::EncodeChar6((char)V), 6);
+      break;
+    }
+  }
+
   /// EmitRecordWithAbbrevImpl - This is the core implementation of the record
   /// emission code.  If BlobData is non-null, then it specifies an array of
   /// data that should be emitted as part of the Blob or Array operand that is
@@ -415,8 +442,8 @@ private:
           EmitVBR(static_cast<uint32_t>(BlobLen), 6);
 
           // Emit each field.
-          for (unsigned i = 0; i != BlobLen; ++i)
-            EmitAbbreviatedField(EltEnc, (unsigned char)BlobData[i]);
+          EmitAbbreviatedArray(
+              EltEnc, makeArrayRef((const unsigned char *)BlobData, BlobLen));
 
           // Know that blob data is consumed for assertion below.
           BlobData = nullptr;
@@ -425,8 +452,8 @@ private:
           EmitVBR(static_cast<uint32_t>(Vals.size()-RecordIdx), 6);
 
           // Emit each field.
-          for (unsigned e = Vals.size(); RecordIdx != e; ++RecordIdx)
-            EmitAbbreviatedField(EltEnc, Vals[RecordIdx]);
+          EmitAbbreviatedArray(EltEnc, Vals.slice(RecordIdx));
+          RecordIdx = Vals.size();
         }
       } else if (Op.getEncoding() == BitCodeAbbrevOp::Blob) {
         // If this record has blob data, emit it, otherwise we must have record
@@ -42,6 +42,15 @@ struct BBClusterInfo {
 
 using ProgramBBClusterInfoMapTy = StringMap<SmallVector<BBClusterInfo>>;
 
+// The slice of the profile buffer holding the cluster lines of one function,
+// along with the number of the first line of the slice within the profile.
+// The cluster lines are parsed lazily, on the first query for their function,
+// so a module only pays for the entries of the functions it defines.
+struct FunctionProfileSlice {
+  StringRef Text;
+  unsigned FirstLineNumber = 0;
+};
+
 class BasicBlockSectionsProfileReader : public ImmutablePass {
 public:
   static char ID;
@@ -83,16 +92,26 @@ private:
     return R == FuncAliasMap.end() ? FuncName : R->second;
   }
 
+  // Parses the cluster lines of function \p FuncName from its profile slice
+  // and caches the result in ProgramBBClusterInfo.
+  ProgramBBClusterInfoMapTy::iterator
+  parseFunctionProfile(StringRef FuncName,
+                       const FunctionProfileSlice &Slice) const;
+
   // This contains the basic-block-sections profile.
   const MemoryBuffer *MBuf = nullptr;
 
+  // Maps every function name in the profile to the still unparsed slice of
+  // the profile holding its cluster lines.
+  StringMap<FunctionProfileSlice> FunctionProfiles;
+
   // This encapsulates the BB cluster information for the whole program.
   //
   // For every function name, it contains the cluster information for (all or
   // some of) its basic blocks. The cluster information for every basic block
   // includes its cluster ID along with the position of the basic block in that
-  // cluster.
-  ProgramBBClusterInfoMapTy ProgramBBClusterInfo;
+  // cluster. Entries are built on demand from FunctionProfiles.
+  mutable ProgramBBClusterInfoMapTy ProgramBBClusterInfo;
 
   // Some functions have alias names. We use this map to find the main alias
   // name for which we have mapping in ProgramBBClusterInfo.
@@ -17,6 +17,7 @@
 #define LLVM_CODEGEN_LIVEINTERVALUNION_H
 
 #include "llvm/ADT/IntervalMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/CodeGen/LiveInterval.h"
 #include "llvm/CodeGen/SlotIndexes.h"
@@ -115,6 +116,9 @@ public:
     LiveRange::const_iterator LRI;  ///< current position in LR
     ConstSegmentIter LiveUnionI;    ///< current position in LiveUnion
     SmallVector<const LiveInterval *, 4> InterferingVRegs;
+    /// The set of registers in InterferingVRegs, used to keep membership
+    /// checks constant time when many registers interfere.
+    SmallPtrSet<const LiveInterval *, 8> SeenInterferences;
     bool CheckedFirstInterference = false;
     bool SeenAllInterferences = false;
     unsigned Tag = 0;
@@ -139,6 +143,7 @@ public:
       LiveUnion = &NewLiveUnion;
       LR = &NewLR;
       InterferingVRegs.clear();
+      SeenInterferences.clear();
       CheckedFirstInterference = false;
       SeenAllInterferences = false;
       Tag = NewLiveUnion.getTag();
@@ -35,6 +35,7 @@
 namespace llvm {
 
   class AAResults;
+  class BatchAAResults;
   class LiveIntervals;
   class MachineFrameInfo;
   class MachineFunction;
@@ -174,7 +175,11 @@ namespace llvm {
     /// Tracks the last instructions in this region using each virtual register.
     VReg2SUnitOperIdxMultiMap CurrentVRegUses;
 
-    AAResults *AAForDep = nullptr;
+    /// Batch alias analysis used for memory dependencies while the graph is
+    /// being built; only valid during buildSchedGraph(). The IR does not
+    /// change during DAG construction, so query state can be reused across
+    /// all the pairwise memory-operand checks.
+    BatchAAResults *AAForDep = nullptr;
 
     /// Remember a generic side-effecting instruction as we proceed.
     /// No other SU ever gets scheduled around it (except in the special
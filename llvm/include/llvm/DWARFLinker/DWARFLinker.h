@@ -513,12 +513,14 @@ private:
                                    unsigned Flags);
 
   /// Resolve the DIE attribute reference that has been extracted in \p
-  /// RefValue. The resulting DIE might be in another CompileUnit which is
-  /// stored into \p ReferencedCU. \returns null if resolving fails for any
-  /// reason.
+  /// RefValue. \p CU is the unit containing the referring \p DIE; most
+  /// references are unit-local and resolve there without searching \p Units.
+  /// The resulting DIE might be in another CompileUnit which is stored into
+  /// \p ReferencedCU. \returns null if resolving fails for any reason.
   DWARFDie resolveDIEReference(const DWARFFile &File, const UnitListTy &Units,
                                const DWARFFormValue &RefValue,
-                               const DWARFDie &DIE, CompileUnit *&RefCU);
+                               const DWARFDie &DIE, CompileUnit &CU,
+                               CompileUnit *&RefCU);
 
   /// @}
 
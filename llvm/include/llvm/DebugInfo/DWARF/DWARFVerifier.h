@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace llvm {
 class raw_ostream;
@@ -85,7 +86,12 @@ private:
   // Used to relax some checks that do not currently work portably
   bool IsObjectFile;
   bool IsMachOObject;
-  using ReferenceMap = std::map<uint64_t, std::set<uint64_t>>;
+  /// Maps a referenced DIE offset to the offsets of the DIEs referencing it.
+  /// The referencing offsets are recorded in DIE walk order and may contain
+  /// duplicates; they are only sorted and uniqued when a reference turns out
+  /// to be invalid and gets reported. Heavily referenced DIEs (types) would
+  /// otherwise cost one set node per referencing attribute.
+  using ReferenceMap = std::map<uint64_t, std::vector<uint64_t>>;
 
   raw_ostream &error() const;
   raw_ostream &warn() const;
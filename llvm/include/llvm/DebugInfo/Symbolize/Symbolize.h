@@ -199,6 +199,13 @@ private:
   /// Contains parsed binary for each path, or parsing error.
   std::map<std::string, CachedBinary> BinaryForPath;
 
+  /// Memoizes the most recently accessed entry of BinaryForPath. Batch
+  /// symbolization hits the same binary for every address, and this avoids a
+  /// map lookup per query. Invalidated when the entry it points to is
+  /// evicted by pruneCache() or the caches are flushed.
+  CachedBinary *LastBinary = nullptr;
+  std::string LastBinaryPath;
+
   /// A list of cached binaries in LRU order.
   simple_ilist<CachedBinary> LRUBinaries;
   /// Sum of the sizes of the cached binaries.
@@ -0,0 +1,83 @@
+//===- OnDiskObjectCache.h - Persistent object cache ------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// A content-addressed on-disk ObjectCache. Modules are keyed by a hash of
+// their bitcode (plus a client-supplied salt covering codegen options), so
+// byte-identical modules hit the cache across process restarts.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
+#define LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/Support/Error.h"
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace llvm {
+namespace orc {
+
+/// A persistent ObjectCache that stores one relocatable object file per
+/// module under a cache directory, named by a hash of the module contents.
+///
+/// Plug an instance into SimpleCompiler or ConcurrentIRCompiler to skip
+/// recompilation of modules that were already compiled by an earlier process:
+///
+/// \code{.cpp}
+///   auto Cache = cantFail(OnDiskObjectCache::Create(CacheDir));
+///   ConcurrentIRCompiler Compile(JTMB);
+///   Compile.setObjectCache(Cache.get());
+/// \endcode
+///
+/// Cached objects are reloaded with MemoryBuffer::getFile, so large objects
+/// are mapped rather than copied. All methods are thread-safe and may be
+/// called concurrently by ConcurrentIRCompiler.
+class OnDiskObjectCache : public ObjectCache {
+public:
+  /// Create a cache rooted at \p CacheDir, creating the directory (and any
+  /// missing parents) if necessary.
+  ///
+  /// \p KeySalt is mixed into every cache key and should cover anything that
+  /// affects code generation but is not part of the module itself, e.g. the
+  /// target CPU, feature string and relocation model. Clients that change
+  /// codegen options between runs must change the salt accordingly.
+  static Expected<std::unique_ptr<OnDiskObjectCache>>
+  Create(StringRef CacheDir, StringRef KeySalt = "");
+
+  /// Store the object compiled for \p M. Failures to write are ignored: the
+  /// cache is advisory and the in-memory object is unaffected.
+  void notifyObjectCompiled(const Module *M, MemoryBufferRef Obj) override;
+
+  /// Return the cached object for \p M, or nullptr on a cache miss.
+  std::unique_ptr<MemoryBuffer> getObject(const Module *M) override;
+
+private:
+  OnDiskObjectCache(std::string CacheDir, std::string KeySalt)
+      : CacheDir(std::move(CacheDir)), KeySalt(std::move(KeySalt)) {}
+
+  std::string getCacheKey(const Module &M) const;
+  SmallString<128> getPathForKey(StringRef Key) const;
+
+  std::string CacheDir;
+  std::string KeySalt;
+
+  // Keys computed in getObject, reused by the matching notifyObjectCompiled
+  // call so the bitcode is only hashed once per compile.
+  std::mutex KeysMutex;
+  DenseMap<const Module *, std::string> Keys;
+};
+
+} // end namespace orc
+} // end namespace llvm
+
+#endif // LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
@@ -134,13 +134,20 @@ public:
 
   // Speculatively compile likely functions for the given Stub Address.
   // destination of __orc_speculate_for jump
-  void speculateFor(TargetFAddr StubAddr) { launchCompile(StubAddr); }
+  void speculateFor(TargetFAddr StubAddr) {
+    // This runs on the thread that took the first call into the stub: hand
+    // the candidate walk and the speculative lookups to the session's
+    // dispatcher so the caller does not wait on them.
+    ES.dispatchTask(makeGenericNamedTask(
+        [this, StubAddr]() { launchCompile(StubAddr); },
+        "Speculative compile task"));
+  }
 
   // FIXME : Register with Stub Address, after JITLink Fix.
   void registerSymbols(FunctionCandidatesMap Candidates, JITDylib *JD) {
     for (auto &SymPair : Candidates) {
       auto Target = SymPair.first;
-      auto Likely = SymPair.second;
+      auto Likely = std::move(SymPair.second);
 
       auto OnReadyFixUp = [Likely, Target,
                            this](Expected<SymbolMap> ReadySymbol) {
@@ -7,18 +7,16 @@
 //===----------------------------------------------------------------------===//
 //
 // This file provides hashing of the LLVM IR structure to be used to check
-// Passes modification status.
+// Passes modification status and as a stable, cheap key identifying a
+// function body across compiler invocations (e.g. for inter-run caching).
 //
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_IR_STRUCTURALHASH_H
 #define LLVM_IR_STRUCTURALHASH_H
 
-#ifdef EXPENSIVE_CHECKS
-
 #include <cstdint>
 
-// This header is only meant to be used when -DEXPENSIVE_CHECKS is set
 namespace llvm {
 
 class Function;
@@ -29,6 +27,4 @@ uint64_t StructuralHash(const Module &M);
 
 } // end namespace llvm
 
-#endif
-
 #endif // LLVM_IR_STRUCTURALHASH_H
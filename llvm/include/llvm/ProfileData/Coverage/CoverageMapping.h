@@ -581,8 +581,21 @@ class CoverageMapping {
       IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage);
 
   /// Add a function record corresponding to \p Record.
+  /// Hashes of a coverage record's filename array, combined and for each
+  /// filename. All function records of a translation unit reference the same
+  /// filename array, so the hashes are computed once per array rather than
+  /// once per function. Keyed by the array itself; only valid while the
+  /// reader owning the filenames is alive.
+  struct FilenamesHashes {
+    size_t CombinedHash;
+    SmallVector<size_t, 0> PerFilenameHashes;
+  };
+  using FilenamesHashCache =
+      DenseMap<std::pair<const StringRef *, size_t>, FilenamesHashes>;
+
   Error loadFunctionRecord(const CoverageMappingRecord &Record,
-                           IndexedInstrProfReader &ProfileReader);
+                           IndexedInstrProfReader &ProfileReader,
+                           FilenamesHashCache &HashCache);
 
   /// Look up the indices for function records which are at least partially
   /// defined in the specified file. This is guaranteed to return a superset of
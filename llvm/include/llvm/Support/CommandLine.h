@@ -233,7 +233,10 @@ public:
 
   SmallVector<Option *, 4> PositionalOpts;
   SmallVector<Option *, 4> SinkOpts;
-  StringMap<Option *> OptionsMap;
+  // A typical tool registers many hundreds of options into this map during
+  // static initialization; start the table large enough that the registration
+  // storm does not repeatedly grow and redistribute it.
+  StringMap<Option *> OptionsMap{/*InitialSize=*/256};
 
   Option *ConsumeAfterOpt = nullptr; // The ConsumeAfter option if it exists.
 };
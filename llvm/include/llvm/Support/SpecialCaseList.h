@@ -55,6 +55,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Regex.h"
 #include "llvm/Support/TrigramIndex.h"
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -127,7 +128,14 @@ protected:
     unsigned match(StringRef Query) const;
 
   private:
+    unsigned matchPrefixes(StringRef Query) const;
+
     StringMap<unsigned> Strings;
+    /// Entries of the form "literal*" (a literal prefix followed by a single
+    /// trailing wildcard), which make up the bulk of large exclusion lists.
+    /// Kept sorted so a query is matched against all of them with a binary
+    /// search instead of one regex execution per entry.
+    std::map<std::string, unsigned, std::less<>> Prefixes;
     TrigramIndex Trigrams;
     std::vector<std::pair<std::unique_ptr<Regex>, unsigned>> RegExes;
   };
@@ -205,6 +205,11 @@ private:
   unsigned ActiveThreads = 0;
   /// Number of threads active for tasks in the given group (only non-zero).
   DenseMap<ThreadPoolTaskGroup *, unsigned> ActiveGroups;
+  /// Number of worker threads blocked in a recursive wait() on a group,
+  /// i.e. processing tasks (or sleeping on QueueCondition) until their group
+  /// finishes. Group completions only need to broadcast on QueueCondition
+  /// when this is non-zero.
+  unsigned RecursiveGroupWaiters = 0;
 
 #if LLVM_ENABLE_THREADS // avoids warning for unused variable
   /// Signal for the destruction of the pool, asking thread to exit.
@@ -18,6 +18,7 @@
 #include "llvm/ADT/None.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/STLFunctionalExtras.h"
 #include "llvm/Support/Chrono.h"
@@ -761,6 +762,10 @@ public:
   /// A directory in the vfs with explicitly specified contents.
   class DirectoryEntry : public Entry {
     std::vector<std::unique_ptr<Entry>> Contents;
+    /// Maps the (case-normalized) name of each child to the child itself.
+    /// Only built for large directories once the tree is fully constructed;
+    /// left empty otherwise, in which case lookups scan \c Contents.
+    llvm::StringMap<Entry *> ContentsIndex;
     Status S;
 
   public:
@@ -778,10 +783,24 @@ public:
 
     void addContent(std::unique_ptr<Entry> Content) {
       Contents.push_back(std::move(Content));
+      // The index, if any, no longer covers all of the contents.
+      ContentsIndex.clear();
     }
 
     Entry *getLastContent() const { return Contents.back().get(); }
 
+    /// Build an index over the contents for by-name child lookups. Only
+    /// meaningful once the directory tree is fully constructed. Directories
+    /// with few children, or with names the index cannot represent
+    /// unambiguously, keep an empty index and are scanned linearly instead.
+    void buildIndex(bool CaseSensitive);
+
+    bool hasIndex() const { return !ContentsIndex.empty(); }
+
+    /// Get the child named \p Name, or null if there is none. Only valid
+    /// when \c hasIndex() is true.
+    Entry *lookupIndexed(StringRef Name, bool CaseSensitive) const;
+
     using iterator = decltype(Contents)::iterator;
 
     iterator contents_begin() { return Contents.begin(); }
@@ -950,6 +969,11 @@ private:
   ErrorOr<Status> status(const Twine &CanonicalPath, const Twine &OriginalPath,
                          const LookupResult &Result);
 
+  /// Build the per-directory child indices used by \c lookupPathImpl. Must
+  /// only be called once the directory tree is fully constructed and the
+  /// case sensitivity is known.
+  void buildIndices();
+
 public:
   /// Looks up \p Path in \c Roots and returns a LookupResult giving the
   /// matched entry and, if the entry was a FileEntry or DirectoryRemapEntry,
@@ -1201,12 +1201,10 @@ AliasResult BasicAAResult::aliasGEP(
     return AliasResult::MayAlias;
 
   APInt GCD;
-  ConstantRange OffsetRange = ConstantRange(DecompGEP1.Offset);
   for (unsigned i = 0, e = DecompGEP1.VarIndices.size(); i != e; ++i) {
-    const VariableGEPIndex &Index = DecompGEP1.VarIndices[i];
-    const APInt &Scale = Index.Scale;
+    const APInt &Scale = DecompGEP1.VarIndices[i].Scale;
     APInt ScaleForGCD = Scale;
-    if (!Index.IsNSW)
+    if (!DecompGEP1.VarIndices[i].IsNSW)
       ScaleForGCD = APInt::getOneBitSet(Scale.getBitWidth(),
                                         Scale.countTrailingZeros());
 
@@ -1214,7 +1212,29 @@ AliasResult BasicAAResult::aliasGEP(
       GCD = ScaleForGCD.abs();
     else
       GCD = APIntOps::GreatestCommonDivisor(GCD, ScaleForGCD.abs());
+  }
 
+  // We now have accesses at two offsets from the same base:
+  //  1. (...)*GCD + DecompGEP1.Offset with size V1Size
+  //  2. 0 with size V2Size
+  // Using arithmetic modulo GCD, the accesses are at
+  // [ModOffset..ModOffset+V1Size) and [0..V2Size). If the first access fits
+  // into the range [V2Size..GCD), then we know they cannot overlap.
+  APInt ModOffset = DecompGEP1.Offset.srem(GCD);
+  if (ModOffset.isNegative())
+    ModOffset += GCD; // We want mod, not rem.
+  if (ModOffset.uge(V2Size.getValue()) &&
+      (GCD - ModOffset).uge(V1Size.getValue()))
+    return AliasResult::NoAlias;
+
+  // Compute ranges of potentially accessed bytes for both accesses. If the
+  // interseciton is empty, there can be no overlap. This needs known-bits and
+  // assumption queries for every variable index, which is much more expensive
+  // than the scale GCD above, so it is only done once the modular check has
+  // failed to disambiguate the accesses.
+  ConstantRange OffsetRange = ConstantRange(DecompGEP1.Offset);
+  for (const VariableGEPIndex &Index : DecompGEP1.VarIndices) {
+    const APInt &Scale = Index.Scale;
     ConstantRange CR = computeConstantRange(Index.Val.V, /* ForSigned */ false,
                                             true, &AC, Index.CxtI);
     KnownBits Known =
@@ -1232,21 +1252,6 @@ AliasResult BasicAAResult::aliasGEP(
       OffsetRange = OffsetRange.add(CR.smul_fast(ConstantRange(Scale)));
   }
 
-  // We now have accesses at two offsets from the same base:
-  //  1. (...)*GCD + DecompGEP1.Offset with size V1Size
-  //  2. 0 with size V2Size
-  // Using arithmetic modulo GCD, the accesses are at
-  // [ModOffset..ModOffset+V1Size) and [0..V2Size). If the first access fits
-  // into the range [V2Size..GCD), then we know they cannot overlap.
-  APInt ModOffset = DecompGEP1.Offset.srem(GCD);
-  if (ModOffset.isNegative())
-    ModOffset += GCD; // We want mod, not rem.
-  if (ModOffset.uge(V2Size.getValue()) &&
-      (GCD - ModOffset).uge(V1Size.getValue()))
-    return AliasResult::NoAlias;
-
-  // Compute ranges of potentially accessed bytes for both accesses. If the
-  // interseciton is empty, there can be no overlap.
   unsigned BW = OffsetRange.getBitWidth();
   ConstantRange Range1 = OffsetRange.add(
       ConstantRange(APInt(BW, 0), APInt(BW, V1Size.getValue())));
@@ -619,6 +619,14 @@ bool CGSCCAnalysisManagerModuleProxy::Result::invalidate(
     return true;
   }
 
+  // If no SCC analyses have been cached at all there is nothing to invalidate
+  // and no deferred outer invalidations can have been registered, so don't
+  // build the RefSCCs and walk every SCC of the graph just to find that out.
+  // On large modules that walk is far more expensive than the invalidation
+  // itself.
+  if (InnerAM->empty())
+    return false;
+
   // Directly check if the relevant set is preserved so we can short circuit
   // invalidating SCCs below.
   bool AreSCCAnalysesPreserved =
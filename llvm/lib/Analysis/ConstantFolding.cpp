@@ -54,6 +54,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/KnownBits.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/SwapByteOrder.h"
 #include <cassert>
 #include <cerrno>
 #include <cfenv>
@@ -499,6 +500,23 @@ bool ReadDataFromGlobal(Constant *C, uint64_t ByteOffset, unsigned char *CurPtr,
     // not reached.
   }
 
+  // A ConstantDataSequential's payload is a flat array of host-endian
+  // elements of byte-multiple size, which is exactly the in-memory image of
+  // the initializer whenever host and target endianness agree. Copy the
+  // requested bytes directly instead of materializing a uniqued Constant for
+  // every element just to serialize it again; large data arrays make the
+  // element-wise path quadratic in allocated constants.
+  if (auto *CDS = dyn_cast<ConstantDataSequential>(C)) {
+    if (DL.isLittleEndian() == sys::IsLittleEndianHost) {
+      StringRef Data = CDS->getRawDataValues();
+      if (ByteOffset <= Data.size()) {
+        uint64_t N = std::min(uint64_t(BytesLeft), Data.size() - ByteOffset);
+        memcpy(CurPtr, Data.data() + ByteOffset, N);
+        return true;
+      }
+    }
+  }
+
   if (isa<ConstantArray>(C) || isa<ConstantVector>(C) ||
       isa<ConstantDataSequential>(C)) {
     uint64_t NumElts;
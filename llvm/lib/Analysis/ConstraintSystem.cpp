@@ -78,9 +78,7 @@ bool ConstraintSystem::eliminateUsingFM() {
           return false;
         NR.push_back(N);
 
-        NewGCD = APIntOps::GreatestCommonDivisor({32, (uint32_t)NR.back()},
-                                                 {32, NewGCD})
-                     .getZExtValue();
+        NewGCD = (uint32_t)GreatestCommonDivisor64((uint32_t)NR.back(), NewGCD);
       }
       NewSystem.push_back(std::move(NR));
       // Give up if the new system gets too big.
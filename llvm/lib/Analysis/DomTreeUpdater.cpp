@@ -234,9 +234,25 @@ void DomTreeUpdater::applyUpdates(ArrayRef<DominatorTree::UpdateType> Updates) {
 
   if (Strategy == UpdateStrategy::Lazy) {
     PendUpdates.reserve(PendUpdates.size() + Updates.size());
-    for (const auto &U : Updates)
-      if (!isSelfDominance(U))
-        PendUpdates.push_back(U);
+    for (const auto &U : Updates) {
+      if (isSelfDominance(U))
+        continue;
+      // The batch updater legalizes pending updates by counting insertions
+      // and deletions of each edge, so an update followed by its exact
+      // inverse is a no-op. Cancel such pairs eagerly to keep the queue (and
+      // the flush-time legalization work) small, but only while no tree has
+      // consumed the earlier update yet.
+      if (PendUpdates.size() > PendDTUpdateIndex &&
+          PendUpdates.size() > PendPDTUpdateIndex) {
+        const auto &Last = PendUpdates.back();
+        if (Last.getFrom() == U.getFrom() && Last.getTo() == U.getTo() &&
+            Last.getKind() != U.getKind()) {
+          PendUpdates.pop_back();
+          continue;
+        }
+      }
+      PendUpdates.push_back(U);
+    }
 
     return;
   }
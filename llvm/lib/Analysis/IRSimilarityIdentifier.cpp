@@ -922,24 +922,26 @@ static void createCandidatesFromSuffixTree(
   if (StringLen < 2)
     return;
 
-  // Create an IRSimilarityCandidate for instance of this subsequence \p RS.
-  for (const unsigned &StartIdx : RS.StartIndices) {
-    unsigned EndIdx = StartIdx + StringLen - 1;
-
-    // Check that this subsequence does not contain an illegal instruction.
-    bool ContainsIllegal = false;
-    for (unsigned CurrIdx = StartIdx; CurrIdx <= EndIdx; CurrIdx++) {
-      unsigned Key = IntegerMapping[CurrIdx];
-      if (Key > Mapper.IllegalInstrNumber) {
-        ContainsIllegal = true;
-        break;
-      }
-    }
+  if (RS.StartIndices.empty())
+    return;
 
+  // Check that this subsequence does not contain an illegal instruction.
+  // Every occurrence of the repeated subsequence maps to the same integer
+  // sequence, so checking the first occurrence covers all of them; legality
+  // does not need to be rechecked for each instance.
+  unsigned FirstStartIdx = RS.StartIndices[0];
+  for (unsigned CurrIdx = FirstStartIdx; CurrIdx < FirstStartIdx + StringLen;
+       CurrIdx++) {
+    unsigned Key = IntegerMapping[CurrIdx];
     // If we have an illegal instruction, we should not create an
     // IRSimilarityCandidate for this region.
-    if (ContainsIllegal)
-      continue;
+    if (Key > Mapper.IllegalInstrNumber)
+      return;
+  }
+
+  // Create an IRSimilarityCandidate for instance of this subsequence \p RS.
+  for (const unsigned &StartIdx : RS.StartIndices) {
+    unsigned EndIdx = StartIdx + StringLen - 1;
 
     // We are getting iterators to the instructions in this region of code
     // by advancing the start and end indices from the start of the
@@ -1182,7 +1184,7 @@ void IRSimilarityIdentifier::findCandidates(
       // IRSimilarityCandidate.  If there is only one, that means there is no
       // other repeated subsequence with the same structure.
       if (Group.second.size() > 1)
-        SimilarityCandidates->push_back(Group.second);
+        SimilarityCandidates->push_back(std::move(Group.second));
 
     CandsForRepSubstring.clear();
     StructuralGroups.clear();
@@ -626,12 +626,26 @@ class InlineCostCallAnalyzer final : public CallAnalyzer {
   }
 
   bool onCallBaseVisitStart(CallBase &Call) override {
+    // This runs for every call instruction in every analyzed callee, and the
+    // annotation attributes queried below are almost never present. Resolve
+    // the callsite and called-function attribute sets once so each kind costs
+    // a single lookup instead of a full CallBase::getFnAttr walk.
+    AttributeSet CallAttrs = Call.getAttributes().getFnAttrs();
+    AttributeSet CalleeAttrs;
+    if (const Function *F = Call.getCalledFunction())
+      CalleeAttrs = F->getAttributes().getFnAttrs();
+    auto GetCallAttrAsInt = [&](StringRef Kind) {
+      Attribute A = CallAttrs.getAttribute(Kind);
+      if (!A.isValid())
+        A = CalleeAttrs.getAttribute(Kind);
+      return getStringFnAttrAsInt(A);
+    };
+
     if (Optional<int> AttrCallThresholdBonus =
-            getStringFnAttrAsInt(Call, "call-threshold-bonus"))
+            GetCallAttrAsInt("call-threshold-bonus"))
       Threshold += *AttrCallThresholdBonus;
 
-    if (Optional<int> AttrCallCost =
-            getStringFnAttrAsInt(Call, "call-inline-cost")) {
+    if (Optional<int> AttrCallCost = GetCallAttrAsInt("call-inline-cost")) {
       addCost(*AttrCallCost);
       // Prevent further processing of the call since we want to override its
       // inline cost, not just add to it.
@@ -111,9 +111,12 @@ LazyCallGraph::EdgeSequence &LazyCallGraph::Node::populateSlow() {
                       LazyCallGraph::Edge::Call);
             }
 
+      // Constant data (ints, floats, null pointers, zero aggregates, ...) has
+      // no operands and can never reference a function, and it makes up the
+      // bulk of constant operands; keep it out of the visited set entirely.
       for (Value *Op : I.operand_values())
         if (Constant *C = dyn_cast<Constant>(Op))
-          if (Visited.insert(C).second)
+          if (!isa<ConstantData>(C) && Visited.insert(C).second)
             Worklist.push_back(C);
     }
 
@@ -197,7 +200,8 @@ LazyCallGraph::LazyCallGraph(
   SmallPtrSet<Constant *, 16> Visited;
   for (GlobalVariable &GV : M.globals())
     if (GV.hasInitializer())
-      if (Visited.insert(GV.getInitializer()).second)
+      if (!isa<ConstantData>(GV.getInitializer()) &&
+          Visited.insert(GV.getInitializer()).second)
         Worklist.push_back(GV.getInitializer());
 
   LLVM_DEBUG(
@@ -1967,8 +1971,9 @@ void LazyCallGraph::visitReferences(SmallVectorImpl<Constant *> &Worklist,
     if (isa<BlockAddress>(C))
       continue;
 
+    // Constant data cannot reference functions; see populateSlow().
     for (Value *Op : C->operand_values())
-      if (Visited.insert(cast<Constant>(Op)).second)
+      if (!isa<ConstantData>(Op) && Visited.insert(cast<Constant>(Op)).second)
         Worklist.push_back(cast<Constant>(Op));
   }
 }
@@ -172,6 +172,12 @@ namespace {
         BlockCache;
     /// Set of value handles used to erase values from the cache on deletion.
     DenseSet<LVIValueHandle, DenseMapInfo<Value *>> ValueHandles;
+    /// For each value, the blocks that may hold cached information for it, so
+    /// that erasing a value visits only those blocks instead of sweeping the
+    /// whole block cache. Entries may be stale (the block was erased, or the
+    /// value was dropped from it when an edge was threaded); they are only
+    /// ever used as lookup keys into BlockCache.
+    DenseMap<Value *, SmallVector<BasicBlock *, 4>> BlocksPerValue;
 
     const BlockCacheEntry *getBlockEntry(BasicBlock *BB) const {
       auto It = BlockCache.find_as(BB);
@@ -207,6 +213,7 @@ namespace {
       else
         Entry->LatticeElements.insert({ Val, Result });
 
+      BlocksPerValue[Val].push_back(BB);
       addValueHandle(Val);
     }
 
@@ -232,8 +239,10 @@ namespace {
       BlockCacheEntry *Entry = getOrCreateBlockEntry(BB);
       if (!Entry->NonNullPointers) {
         Entry->NonNullPointers = InitFn(BB);
-        for (Value *V : *Entry->NonNullPointers)
+        for (Value *V : *Entry->NonNullPointers) {
+          BlocksPerValue[V].push_back(BB);
           addValueHandle(V);
+        }
       }
 
       return Entry->NonNullPointers->count(V);
@@ -243,6 +252,7 @@ namespace {
     void clear() {
       BlockCache.clear();
       ValueHandles.clear();
+      BlocksPerValue.clear();
     }
 
     /// Inform the cache that a given value has been deleted.
@@ -260,11 +270,22 @@ namespace {
 }
 
 void LazyValueInfoCache::eraseValue(Value *V) {
-  for (auto &Pair : BlockCache) {
-    Pair.second->LatticeElements.erase(V);
-    Pair.second->OverDefined.erase(V);
-    if (Pair.second->NonNullPointers)
-      Pair.second->NonNullPointers->erase(V);
+  auto BlocksIt = BlocksPerValue.find(V);
+  if (BlocksIt != BlocksPerValue.end()) {
+    for (BasicBlock *BB : BlocksIt->second) {
+      // A stale block pointer only fails to find an entry: BlockCache keys
+      // are PoisoningVHs, which support lookup with dangling pointers. If the
+      // address was reused by a new block, the erasures below merely drop
+      // cached info, which is always safe.
+      auto It = BlockCache.find_as(BB);
+      if (It == BlockCache.end())
+        continue;
+      It->second->LatticeElements.erase(V);
+      It->second->OverDefined.erase(V);
+      if (It->second->NonNullPointers)
+        It->second->NonNullPointers->erase(V);
+    }
+    BlocksPerValue.erase(BlocksIt);
   }
 
   auto HandleIt = ValueHandles.find_as(V);
@@ -392,12 +392,17 @@ void MemorySSAUpdater::insertDef(MemoryDef *MD, bool RenameUses) {
       // hence add all IDF Phis. See PR43044.
       NonOptPhis.insert(MPhi);
     }
+    // Share one previous-def cache across all the reaching-def walks below;
+    // sibling predecessors otherwise re-walk the same chains of blocks. This
+    // is safe because cached values are TrackingVHs, so entries follow any
+    // phi simplification a later walk performs, and a walk never creates a
+    // phi in a block that already has a cache entry (the cache hit returns
+    // before the cycle-breaking path is reached).
+    DenseMap<BasicBlock *, TrackingVH<MemoryAccess>> CachedPreviousDef;
     for (auto &MPhi : NewInsertedPHIs) {
       auto *BBIDF = MPhi->getBlock();
-      for (auto *Pred : predecessors(BBIDF)) {
-        DenseMap<BasicBlock *, TrackingVH<MemoryAccess>> CachedPreviousDef;
+      for (auto *Pred : predecessors(BBIDF))
         MPhi->addIncoming(getPreviousDefFromEnd(Pred, CachedPreviousDef), Pred);
-      }
     }
 
     // Re-take the index where we're adding the new phis, because the above call
@@ -6429,19 +6429,33 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   if (StripDebugInfo)
     stripDebugInfo(*F);
 
-  // Upgrade any old intrinsic calls in the function.
-  for (auto &I : UpgradedIntrinsics) {
-    for (User *U : llvm::make_early_inc_range(I.first->materialized_users()))
-      if (CallInst *CI = dyn_cast<CallInst>(U))
-        UpgradeIntrinsicCall(CI, I.second);
+  // Upgrade any old intrinsic calls and update calls to remangled intrinsics
+  // in the function. Only the just-materialized body can contain new call
+  // sites, so walk its instructions rather than all materialized users of
+  // every old intrinsic; the latter revisits each previously materialized
+  // call site once per function and is quadratic under heavy lazy importing.
+  // Call sites materialized later are handled when their function is
+  // materialized (or by the final sweep in materializeModule()).
+  if (!UpgradedIntrinsics.empty() || !RemangledIntrinsics.empty()) {
+    for (Instruction &I : llvm::make_early_inc_range(instructions(F))) {
+      auto *CB = dyn_cast<CallBase>(&I);
+      if (!CB)
+        continue;
+      Function *Callee = CB->getCalledFunction();
+      if (!Callee)
+        continue;
+      auto UI = UpgradedIntrinsics.find(Callee);
+      if (UI != UpgradedIntrinsics.end()) {
+        if (auto *CI = dyn_cast<CallInst>(CB))
+          UpgradeIntrinsicCall(CI, UI->second);
+        continue;
+      }
+      auto RI = RemangledIntrinsics.find(Callee);
+      if (RI != RemangledIntrinsics.end())
+        CB->setCalledFunction(RI->second);
+    }
   }
 
-  // Update calls to the remangled intrinsics
-  for (auto &I : RemangledIntrinsics)
-    for (User *U : llvm::make_early_inc_range(I.first->materialized_users()))
-      // Don't expect any other users than call sites
-      cast<CallBase>(U)->setCalledFunction(I.second);
-
   // Finish fn->subprogram upgrade for materialized functions.
   if (DISubprogram *SP = MDLoader->lookupSubprogramForFunction(F))
     F->setSubprogram(SP);
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/DbgEntityHistoryCalculator.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallSet.h"
@@ -25,7 +26,6 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cassert>
-#include <map>
 #include <utility>
 
 using namespace llvm;
@@ -280,15 +280,17 @@ void DbgLabelInstrMap::addInstr(InlinedEntity Label, const MachineInstr &MI) {
 
 namespace {
 
-// Maps physreg numbers to the variables they describe.
+// Maps physreg numbers to the variables they describe. These maps are probed
+// for every def operand and register alias of every instruction, so use hash
+// maps; where iteration order is observable the callers sort explicitly.
 using InlinedEntity = DbgValueHistoryMap::InlinedEntity;
-using RegDescribedVarsMap = std::map<unsigned, SmallVector<InlinedEntity, 1>>;
+using RegDescribedVarsMap = DenseMap<unsigned, SmallVector<InlinedEntity, 1>>;
 
 // Keeps track of the debug value entries that are currently live for each
 // inlined entity. As the history map entries are stored in a SmallVector, they
 // may be moved at insertion of new entries, so store indices rather than
 // pointers.
-using DbgValueEntriesMap = std::map<InlinedEntity, SmallSet<EntryIndex, 1>>;
+using DbgValueEntriesMap = DenseMap<InlinedEntity, SmallSet<EntryIndex, 1>>;
 
 } // end anonymous namespace
 
@@ -423,15 +425,19 @@ static void clobberRegisterUses(RegDescribedVarsMap &RegVars,
   // Iterate over all variables described by this register and add this
   // instruction to their history, clobbering it. All registers that also
   // describe the clobbered variables (i.e. in variadic debug values) will have
-  // those Variables removed from their DescribedVars.
-  for (const auto &Var : I->second) {
+  // those Variables removed from their DescribedVars. Take ownership of the
+  // variable list and erase the map entry up front so that dropping fellow
+  // registers cannot invalidate the iterator.
+  unsigned RegNo = I->first;
+  SmallVector<InlinedEntity, 1> Vars = std::move(I->second);
+  RegVars.erase(I);
+  for (const auto &Var : Vars) {
     SmallVector<Register, 4> FellowRegisters;
-    clobberRegEntries(Var, I->first, ClobberingInstr, LiveEntries, HistMap,
+    clobberRegEntries(Var, RegNo, ClobberingInstr, LiveEntries, HistMap,
                       FellowRegisters);
-    for (Register RegNo : FellowRegisters)
-      dropRegDescribedVar(RegVars, RegNo, Var);
+    for (Register FellowReg : FellowRegisters)
+      dropRegDescribedVar(RegVars, FellowReg, Var);
   }
-  RegVars.erase(I);
 }
 
 // Terminate the location range for variables described by register
@@ -521,6 +527,10 @@ void llvm::calculateDbgEntityHistory(const MachineFunction *MF,
               RegsToClobber.push_back(Reg);
           }
 
+          // Sort for a deterministic clobbering order; a variable described
+          // by several clobbered registers keeps the entry of the first one
+          // processed.
+          llvm::sort(RegsToClobber);
           for (unsigned Reg : RegsToClobber) {
             clobberRegisterUses(RegVars, Reg, DbgValues, LiveEntries, MI);
           }
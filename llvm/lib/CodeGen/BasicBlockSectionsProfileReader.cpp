@@ -29,21 +29,82 @@ INITIALIZE_PASS(BasicBlockSectionsProfileReader, "bbsections-profile-reader",
                 false)
 
 bool BasicBlockSectionsProfileReader::isFunctionHot(StringRef FuncName) const {
-  return getBBClusterInfoForFunction(FuncName).first;
+  return FunctionProfiles.count(getAliasName(FuncName));
 }
 
 std::pair<bool, SmallVector<BBClusterInfo>>
 BasicBlockSectionsProfileReader::getBBClusterInfoForFunction(
     StringRef FuncName) const {
   std::pair<bool, SmallVector<BBClusterInfo>> cluster_info(false, {});
-  auto R = ProgramBBClusterInfo.find(getAliasName(FuncName));
-  if (R != ProgramBBClusterInfo.end()) {
+  auto SI = FunctionProfiles.find(getAliasName(FuncName));
+  if (SI != FunctionProfiles.end()) {
+    auto R = ProgramBBClusterInfo.find(SI->first());
+    if (R == ProgramBBClusterInfo.end())
+      R = parseFunctionProfile(SI->first(), SI->second);
     cluster_info.second = R->second;
     cluster_info.first = true;
   }
   return cluster_info;
 }
 
+// Parses the cluster lines of a single function and caches the result. The
+// slice is not nul terminated, so it is walked line by line instead of going
+// through a line_iterator. A malformed entry is a fatal error, as it is for
+// the structural problems diagnosed when the profile is indexed.
+ProgramBBClusterInfoMapTy::iterator
+BasicBlockSectionsProfileReader::parseFunctionProfile(
+    StringRef FuncName, const FunctionProfileSlice &Slice) const {
+  auto FI = ProgramBBClusterInfo.try_emplace(FuncName).first;
+
+  unsigned LineNumber = Slice.FirstLineNumber;
+  auto invalidProfileError = [&](auto Message) {
+    return make_error<StringError>(
+        Twine("Invalid profile " + MBuf->getBufferIdentifier() + " at line " +
+              Twine(LineNumber) + ": " + Message),
+        inconvertibleErrorCode());
+  };
+
+  // Current cluster ID corresponding to this function.
+  unsigned CurrentCluster = 0;
+  // Current position in the current cluster.
+  unsigned CurrentPosition = 0;
+
+  // Temporary set to ensure every basic block ID appears once in the clusters
+  // of a function.
+  SmallSet<unsigned, 4> FuncBBIDs;
+
+  StringRef Rest = Slice.Text;
+  for (; !Rest.empty(); ++LineNumber) {
+    StringRef S;
+    std::tie(S, Rest) = Rest.split('\n');
+    // Skip anything that is not a cluster line, like the blank, comment and
+    // '@' lines that were kept in the slice.
+    if (!S.consume_front("!!"))
+      continue;
+    SmallVector<StringRef, 4> BBIndexes;
+    S.split(BBIndexes, ' ');
+    // Reset current cluster position.
+    CurrentPosition = 0;
+    for (auto BBIndexStr : BBIndexes) {
+      unsigned long long BBIndex;
+      if (getAsUnsignedInteger(BBIndexStr, 10, BBIndex))
+        report_fatal_error(invalidProfileError(
+            Twine("Unsigned integer expected: '") + BBIndexStr + "'."));
+      if (!FuncBBIDs.insert(BBIndex).second)
+        report_fatal_error(invalidProfileError(
+            Twine("Duplicate basic block id found '") + BBIndexStr + "'."));
+      if (!BBIndex && CurrentPosition)
+        report_fatal_error(
+            invalidProfileError("Entry BB (0) does not begin a cluster."));
+
+      FI->second.emplace_back(
+          BBClusterInfo{((unsigned)BBIndex), CurrentCluster, CurrentPosition++});
+    }
+    CurrentCluster++;
+  }
+  return FI;
+}
+
 // Basic Block Sections can be enabled for a subset of machine basic blocks.
 // This is done by passing a file containing names of functions for which basic
 // block sections are desired.  Additionally, machine basic block ids of the
@@ -58,7 +119,7 @@ BasicBlockSectionsProfileReader::getBBClusterInfoForFunction(
 // !!1 2
 // !!4
 static Error getBBClusterInfo(const MemoryBuffer *MBuf,
-                              ProgramBBClusterInfoMapTy &ProgramBBClusterInfo,
+                              StringMap<FunctionProfileSlice> &FunctionProfiles,
                               StringMap<StringRef> &FuncAliasMap) {
   assert(MBuf);
   line_iterator LineIt(*MBuf, /*SkipBlanks=*/true, /*CommentMarker=*/'#');
@@ -70,19 +131,26 @@ static Error getBBClusterInfo(const MemoryBuffer *MBuf,
         inconvertibleErrorCode());
   };
 
-  auto FI = ProgramBBClusterInfo.end();
-
-  // Current cluster ID corresponding to this function.
-  unsigned CurrentCluster = 0;
-  // Current position in the current cluster.
-  unsigned CurrentPosition = 0;
-
-  // Temporary set to ensure every basic block ID appears once in the clusters
-  // of a function.
-  SmallSet<unsigned, 4> FuncBBIDs;
+  // Slice of the profile covering the cluster lines of the current function.
+  // It is committed to the map when the next function name specifier (or the
+  // end of the list) is reached; the cluster lines themselves are parsed only
+  // when the function is queried, so a module does not pay for the entries of
+  // the functions it does not define.
+  auto FI = FunctionProfiles.end();
+  const char *SliceBegin = nullptr;
+  const char *SliceEnd = nullptr;
+  unsigned FirstLineNumber = 0;
+  auto commitSlice = [&] {
+    if (FI != FunctionProfiles.end() && SliceBegin)
+      FI->second = {StringRef(SliceBegin, SliceEnd - SliceBegin),
+                    FirstLineNumber};
+    SliceBegin = SliceEnd = nullptr;
+    FirstLineNumber = 0;
+  };
 
   for (; !LineIt.is_at_eof(); ++LineIt) {
-    StringRef S(*LineIt);
+    StringRef Line(*LineIt);
+    StringRef S = Line;
     if (S[0] == '@')
       continue;
     // Check for the leading "!"
@@ -90,29 +158,16 @@ static Error getBBClusterInfo(const MemoryBuffer *MBuf,
       break;
     // Check for second "!" which indicates a cluster of basic blocks.
     if (S.consume_front("!")) {
-      if (FI == ProgramBBClusterInfo.end())
+      if (FI == FunctionProfiles.end())
         return invalidProfileError(
             "Cluster list does not follow a function name specifier.");
-      SmallVector<StringRef, 4> BBIndexes;
-      S.split(BBIndexes, ' ');
-      // Reset current cluster position.
-      CurrentPosition = 0;
-      for (auto BBIndexStr : BBIndexes) {
-        unsigned long long BBIndex;
-        if (getAsUnsignedInteger(BBIndexStr, 10, BBIndex))
-          return invalidProfileError(Twine("Unsigned integer expected: '") +
-                                     BBIndexStr + "'.");
-        if (!FuncBBIDs.insert(BBIndex).second)
-          return invalidProfileError(Twine("Duplicate basic block id found '") +
-                                     BBIndexStr + "'.");
-        if (!BBIndex && CurrentPosition)
-          return invalidProfileError("Entry BB (0) does not begin a cluster.");
-
-        FI->second.emplace_back(BBClusterInfo{
-            ((unsigned)BBIndex), CurrentCluster, CurrentPosition++});
+      if (!SliceBegin) {
+        SliceBegin = Line.data();
+        FirstLineNumber = LineIt.line_number();
       }
-      CurrentCluster++;
+      SliceEnd = Line.data() + Line.size();
     } else { // This is a function name specifier.
+      commitSlice();
       // Function aliases are separated using '/'. We use the first function
       // name for the cluster info mapping and delegate all other aliases to
       // this one.
@@ -121,20 +176,18 @@ static Error getBBClusterInfo(const MemoryBuffer *MBuf,
       for (size_t i = 1; i < Aliases.size(); ++i)
         FuncAliasMap.try_emplace(Aliases[i], Aliases.front());
 
-      // Prepare for parsing clusters of this function name.
-      // Start a new cluster map for this function name.
-      FI = ProgramBBClusterInfo.try_emplace(Aliases.front()).first;
-      CurrentCluster = 0;
-      FuncBBIDs.clear();
+      // Prepare for collecting clusters of this function name.
+      FI = FunctionProfiles.try_emplace(Aliases.front()).first;
     }
   }
+  commitSlice();
   return Error::success();
 }
 
 void BasicBlockSectionsProfileReader::initializePass() {
   if (!MBuf)
     return;
-  if (auto Err = getBBClusterInfo(MBuf, ProgramBBClusterInfo, FuncAliasMap))
+  if (auto Err = getBBClusterInfo(MBuf, FunctionProfiles, FuncAliasMap))
     report_fatal_error(std::move(Err));
 }
 
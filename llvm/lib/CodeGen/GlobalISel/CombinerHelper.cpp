@@ -5671,11 +5671,22 @@ bool CombinerHelper::matchAddSubSameReg(MachineInstr &MI, Register &Src) {
 }
 
 bool CombinerHelper::tryCombine(MachineInstr &MI) {
-  if (tryCombineCopy(MI))
-    return true;
-  if (tryCombineExtendingLoads(MI))
-    return true;
-  if (tryCombineIndexedLoadStore(MI))
-    return true;
-  return false;
+  // Dispatch on the opcode up front: this is called for every instruction the
+  // generated combiner did not match, and almost none of them can satisfy any
+  // of these combines, so don't probe each combine's own opcode guard in
+  // turn.
+  switch (MI.getOpcode()) {
+  case TargetOpcode::COPY:
+    return tryCombineCopy(MI);
+  case TargetOpcode::G_LOAD:
+  case TargetOpcode::G_SEXTLOAD:
+  case TargetOpcode::G_ZEXTLOAD:
+    if (tryCombineExtendingLoads(MI))
+      return true;
+    [[fallthrough]];
+  case TargetOpcode::G_STORE:
+    return tryCombineIndexedLoadStore(MI);
+  default:
+    return false;
+  }
 }
@@ -111,11 +111,9 @@ const LiveInterval *LiveIntervalUnion::getOneVReg() const {
   return nullptr;
 }
 
-// Scan the vector of interfering virtual registers in this union. Assume it's
-// quite small.
 bool LiveIntervalUnion::Query::isSeenInterference(
     const LiveInterval *VirtReg) const {
-  return is_contained(InterferingVRegs, VirtReg);
+  return SeenInterferences.contains(VirtReg);
 }
 
 // Collect virtual registers in this union that interfere with this
@@ -158,7 +156,7 @@ LiveIntervalUnion::Query::collectInterferingVRegs(unsigned MaxInterferingRegs) {
     while (LRI->start < LiveUnionI.stop() && LRI->end > LiveUnionI.start()) {
       // This is an overlap, record the interfering register.
       const LiveInterval *VReg = LiveUnionI.value();
-      if (VReg != RecentReg && !isSeenInterference(VReg)) {
+      if (VReg != RecentReg && SeenInterferences.insert(VReg).second) {
         RecentReg = VReg;
         InterferingVRegs.push_back(VReg);
         if (InterferingVRegs.size() >= MaxInterferingRegs)
@@ -241,9 +241,16 @@ void MachineFunction::clear() {
   // Don't call destructors on MachineInstr and MachineOperand. All of their
   // memory comes from the BumpPtrAllocator which is about to be purged.
   //
-  // Do call MachineBasicBlock destructors, it contains std::vectors.
-  for (iterator I = begin(), E = end(); I != E; I = BasicBlocks.erase(I))
-    I->Insts.clearAndLeakNodesUnsafely();
+  // Do call MachineBasicBlock destructors, it contains std::vectors. Since
+  // every block is going away and the recycler free lists are reset below,
+  // destroy the blocks in place and drop the whole list at once instead of
+  // unlinking and recycling them one at a time.
+  for (iterator I = begin(), E = end(); I != E;) {
+    MachineBasicBlock &MBB = *I++;
+    MBB.Insts.clearAndLeakNodesUnsafely();
+    MBB.~MachineBasicBlock();
+  }
+  BasicBlocks.clearAndLeakNodesUnsafely();
   MBBNumbering.clear();
 
   InstructionRecycler.clear(Allocator);
@@ -23,6 +23,7 @@
 // https://groups.google.com/d/msg/llvm-dev/RUegaMg-iqc/wFAVxa6fCgAJ
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/CodeGen/BasicBlockSectionUtils.h"
@@ -191,13 +192,6 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
     return false;
   }
 
-  // Renumbering blocks here preserves the order of the blocks as
-  // sortBasicBlocksAndUpdateBranches uses the numeric identifier to sort
-  // blocks. Preserving the order of blocks is essential to retaining decisions
-  // made by prior passes such as MachineBlockPlacement.
-  MF.RenumberBlocks();
-  MF.setBBSectionsType(BasicBlockSection::Preset);
-
   MachineBlockFrequencyInfo *MBFI = nullptr;
   ProfileSummaryInfo *PSI = nullptr;
   if (UseProfileData) {
@@ -231,6 +225,22 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
         LP->setSectionID(MBBSectionID::ColdSectionID);
     }
   }
+  // If nothing was split out there is no layout to fix up; skip the
+  // renumbering and branch updates below so hot-only functions do not pay for
+  // the basic block section machinery.
+  bool AnySplit = llvm::any_of(MF, [](const MachineBasicBlock &MBB) {
+    return MBB.getSectionID() == MBBSectionID::ColdSectionID;
+  });
+  if (!AnySplit)
+    return false;
+
+  // Renumbering blocks here preserves the order of the blocks as
+  // sortBasicBlocksAndUpdateBranches uses the numeric identifier to sort
+  // blocks. Preserving the order of blocks is essential to retaining decisions
+  // made by prior passes such as MachineBlockPlacement.
+  MF.RenumberBlocks();
+  MF.setBBSectionsType(BasicBlockSection::Preset);
+
   auto Comparator = [](const MachineBasicBlock &X, const MachineBasicBlock &Y) {
     return X.getSectionID().Type < Y.getSectionID().Type;
   };
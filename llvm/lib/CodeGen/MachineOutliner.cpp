@@ -75,6 +75,7 @@
 #include "llvm/Support/SuffixTree.h"
 #include "llvm/Support/raw_ostream.h"
 #include <functional>
+#include <set>
 #include <tuple>
 #include <vector>
 
@@ -533,8 +534,14 @@ void MachineOutliner::findCandidates(
   // First, find all of the repeated substrings in the tree of minimum length
   // 2.
   std::vector<Candidate> CandidatesForRepeatedSeq;
+  // Start indices of the candidates accepted so far for the current sequence.
+  // All candidates for one sequence have the same length, so one ordered
+  // lookup in here replaces an overlap scan over every accepted candidate,
+  // which matters for short sequences repeated many thousands of times.
+  std::set<unsigned> StartIndicesTaken;
   for (const SuffixTree::RepeatedSubstring &RS : ST) {
     CandidatesForRepeatedSeq.clear();
+    StartIndicesTaken.clear();
     unsigned StringLen = RS.Length;
     for (const unsigned &StartIdx : RS.StartIndices) {
       unsigned EndIdx = StartIdx + StringLen - 1;
@@ -559,10 +566,16 @@ void MachineOutliner::findCandidates(
       // That is, one must either
       // * End before the other starts
       // * Start after the other ends
-      if (llvm::all_of(CandidatesForRepeatedSeq, [&StartIdx,
-                                                  &EndIdx](const Candidate &C) {
-            return (EndIdx < C.getStartIdx() || StartIdx > C.getEndIdx());
-          })) {
+      //
+      // Every candidate for this sequence has length StringLen, so an
+      // accepted candidate overlaps [StartIdx, EndIdx] exactly when its
+      // start index lies in [StartIdx - StringLen + 1, EndIdx]. Querying the
+      // set of accepted start indices for that range replaces a scan over
+      // every accepted candidate.
+      unsigned FirstOverlappingStartIdx =
+          StartIdx + 1 >= StringLen ? StartIdx + 1 - StringLen : 0;
+      auto It = StartIndicesTaken.lower_bound(FirstOverlappingStartIdx);
+      if (It == StartIndicesTaken.end() || *It > EndIdx) {
         // It doesn't overlap with anything, so we can outline it.
         // Each sequence is over [StartIt, EndIt].
         // Save the candidate and its location.
@@ -574,6 +587,7 @@ void MachineOutliner::findCandidates(
         CandidatesForRepeatedSeq.emplace_back(StartIdx, StringLen, StartIt,
                                               EndIt, MBB, FunctionList.size(),
                                               Mapper.MBBFlagsMap[MBB]);
+        StartIndicesTaken.insert(StartIdx);
       }
     }
 
@@ -602,7 +616,7 @@ void MachineOutliner::findCandidates(
       continue;
     }
 
-    FunctionList.push_back(OF);
+    FunctionList.push_back(std::move(OF));
   }
 }
 
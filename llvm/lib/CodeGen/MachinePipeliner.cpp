@@ -479,12 +479,32 @@ void SwingSchedulerDAG::schedule() {
   postprocessDAG();
   LLVM_DEBUG(dump());
 
+  // Calculate the resource-constrained MII before enumerating circuits: the
+  // final MII can only be larger, so if it already exceeds the
+  // -pipeliner-max-mii limit the loop is rejected without paying for the
+  // recurrence analysis, which is the most expensive step below. A pragma-set
+  // II overrides the computed MII, so the early exit does not apply then.
+  unsigned ResMII = calculateResMII();
+  if (II_setByPragma == 0 && SwpMaxMii != -1 && (int)ResMII > SwpMaxMii) {
+    LLVM_DEBUG(dbgs() << "ResMII > " << SwpMaxMii
+                      << ", we don't pipeline large loops\n");
+    NumFailLargeMaxMII++;
+    Pass.ORE->emit([&]() {
+      return MachineOptimizationRemarkAnalysis(
+                 DEBUG_TYPE, "schedule", Loop.getStartLoc(), Loop.getHeader())
+             << "Minimal Initiation Interval too large: "
+             << ore::NV("MII", (int)ResMII) << " > "
+             << ore::NV("SwpMaxMii", SwpMaxMii) << "."
+             << "Refer to -pipeliner-max-mii.";
+    });
+    return;
+  }
+
   NodeSetType NodeSets;
   findCircuits(NodeSets);
   NodeSetType Circuits = NodeSets;
 
   // Calculate the MII.
-  unsigned ResMII = calculateResMII();
   unsigned RecMII = calculateRecMII(NodeSets);
 
   fuseRecs(NodeSets);
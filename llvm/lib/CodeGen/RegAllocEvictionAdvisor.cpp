@@ -189,7 +189,10 @@ bool DefaultEvictionAdvisor::canEvictInterferenceBasedOnCost(
   if (Matrix->checkInterference(VirtReg, PhysReg) > LiveRegMatrix::IK_VirtReg)
     return false;
 
-  bool IsLocal = VirtReg.empty() || LIS->intervalIsInOneMBB(VirtReg);
+  // Whether VirtReg is local is only needed on the rare cheap-register path
+  // below, but this advisor is called once per candidate physreg, so don't
+  // pay for the SlotIndexes search up front every time.
+  Optional<bool> IsLocal;
 
   // Find VirtReg's cascade number. This will be unassigned if VirtReg was never
   // involved in an eviction before. If a cascade number was assigned, deny
@@ -262,9 +265,12 @@ bool DefaultEvictionAdvisor::canEvictInterferenceBasedOnCost(
       // If !MaxCost.isMax(), then we're just looking for a cheap register.
       // Evicting another local live range in this case could lead to suboptimal
       // coloring.
-      if (!MaxCost.isMax() && IsLocal && LIS->intervalIsInOneMBB(*Intf) &&
-          (!EnableLocalReassign || !canReassign(*Intf, PhysReg))) {
-        return false;
+      if (!MaxCost.isMax()) {
+        if (!IsLocal)
+          IsLocal = VirtReg.empty() || LIS->intervalIsInOneMBB(VirtReg);
+        if (*IsLocal && LIS->intervalIsInOneMBB(*Intf) &&
+            (!EnableLocalReassign || !canReassign(*Intf, PhysReg)))
+          return false;
       }
     }
   }
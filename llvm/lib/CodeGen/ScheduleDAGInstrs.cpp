@@ -725,7 +725,14 @@ void ScheduleDAGInstrs::buildSchedGraph(AAResults *AA,
   const TargetSubtargetInfo &ST = MF.getSubtarget();
   bool UseAA = EnableAASchedMI.getNumOccurrences() > 0 ? EnableAASchedMI
                                                        : ST.useAA();
-  AAForDep = UseAA ? AA : nullptr;
+  // Batch the alias queries for the whole graph construction: nothing changes
+  // the IR while the dependence graph is built, and the pairwise
+  // memory-operand checks below keep asking about the same underlying
+  // objects.
+  Optional<BatchAAResults> BatchAA;
+  if (UseAA && AA)
+    BatchAA.emplace(*AA);
+  AAForDep = BatchAA ? &*BatchAA : nullptr;
 
   BarrierChain = nullptr;
 
@@ -1010,6 +1017,9 @@ void ScheduleDAGInstrs::buildSchedGraph(AAResults *AA,
   CurrentVRegDefs.clear();
   CurrentVRegUses.clear();
 
+  // The batch AA above is about to go out of scope.
+  AAForDep = nullptr;
+
   Topo.MarkDirty();
 }
 
@@ -480,13 +480,16 @@ bool SelectionDAGISel::runOnMachineFunction(MachineFunction &mf) {
     Register From = I->first;
     Register To = I->second;
     // If To is also scheduled to be replaced, find what its ultimate
-    // replacement is.
+    // replacement is. Record the result so later fixups that funnel through
+    // the same register resolve in one lookup instead of re-walking the
+    // chain; chains grow long in large machine-generated functions.
     while (true) {
       DenseMap<Register, Register>::iterator J = FuncInfo->RegFixups.find(To);
       if (J == E)
         break;
       To = J->second;
     }
+    I->second = To;
     // Make sure the new register has a sufficiently constrained register class.
     if (Register::isVirtualRegister(From) && Register::isVirtualRegister(To))
       MRI.constrainRegClass(To, MRI.getRegClass(From));
@@ -2534,15 +2537,21 @@ CheckOpcode(const unsigned char *MatcherTable, unsigned &MatcherIndex,
 }
 
 LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
-CheckType(const unsigned char *MatcherTable, unsigned &MatcherIndex, SDValue N,
-          const TargetLowering *TLI, const DataLayout &DL) {
-  MVT::SimpleValueType VT = (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
+CheckType(MVT::SimpleValueType VT, SDValue N, const TargetLowering *TLI,
+          const DataLayout &DL) {
   if (N.getValueType() == VT) return true;
 
   // Handle the case when VT is iPTR.
   return VT == MVT::iPTR && N.getValueType() == TLI->getPointerTy(DL);
 }
 
+LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
+CheckType(const unsigned char *MatcherTable, unsigned &MatcherIndex, SDValue N,
+          const TargetLowering *TLI, const DataLayout &DL) {
+  MVT::SimpleValueType VT = (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
+  return ::CheckType(VT, N, TLI, DL);
+}
+
 LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
 CheckChildType(const unsigned char *MatcherTable, unsigned &MatcherIndex,
                SDValue N, const TargetLowering *TLI, const DataLayout &DL,
@@ -2675,6 +2684,14 @@ static unsigned IsPredicateKnownToFail(const unsigned char *Table,
     Result = !::CheckType(Table, Index, N, SDISel.TLI,
                           SDISel.CurDAG->getDataLayout());
     return Index;
+  case SelectionDAGISel::OPC_CheckTypeI32:
+    Result = !::CheckType(MVT::i32, N, SDISel.TLI,
+                          SDISel.CurDAG->getDataLayout());
+    return Index;
+  case SelectionDAGISel::OPC_CheckTypeI64:
+    Result = !::CheckType(MVT::i64, N, SDISel.TLI,
+                          SDISel.CurDAG->getDataLayout());
+    return Index;
   case SelectionDAGISel::OPC_CheckTypeRes: {
     unsigned Res = Table[Index++];
     Result = !::CheckType(Table, Index, N.getValue(Res), SDISel.TLI,
@@ -3117,6 +3134,16 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
         break;
       continue;
 
+    case OPC_CheckTypeI32:
+      if (!::CheckType(MVT::i32, N, TLI, CurDAG->getDataLayout()))
+        break;
+      continue;
+
+    case OPC_CheckTypeI64:
+      if (!::CheckType(MVT::i64, N, TLI, CurDAG->getDataLayout()))
+        break;
+      continue;
+
     case OPC_CheckTypeRes: {
       unsigned Res = MatcherTable[MatcherIndex++];
       if (!::CheckType(MatcherTable, MatcherIndex, N.getValue(Res), TLI,
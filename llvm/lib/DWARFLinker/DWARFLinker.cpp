@@ -63,14 +63,21 @@ static CompileUnit *getUnitForOffset(const UnitListTy &Units, uint64_t Offset) {
 /// Resolve the DIE attribute reference that has been extracted in \p RefValue.
 /// The resulting DIE might be in another CompileUnit which is stored into \p
 /// ReferencedCU. \returns null if resolving fails for any reason.
-DWARFDie DWARFLinker::resolveDIEReference(const DWARFFile &File,
-                                          const UnitListTy &Units,
-                                          const DWARFFormValue &RefValue,
-                                          const DWARFDie &DIE,
-                                          CompileUnit *&RefCU) {
+DWARFDie DWARFLinker::resolveDIEReference(
+    const DWARFFile &File, const UnitListTy &Units,
+    const DWARFFormValue &RefValue, const DWARFDie &DIE, CompileUnit &CU,
+    CompileUnit *&RefCU) {
   assert(RefValue.isFormClass(DWARFFormValue::FC_Reference));
   uint64_t RefOffset = *RefValue.getAsReference();
-  if ((RefCU = getUnitForOffset(Units, RefOffset)))
+  // CU-relative forms resolve within the referring unit, so check it before
+  // searching the whole unit list.
+  DWARFUnit &OrigUnit = CU.getOrigUnit();
+  if (OrigUnit.getOffset() <= RefOffset &&
+      RefOffset < OrigUnit.getNextUnitOffset())
+    RefCU = &CU;
+  else
+    RefCU = getUnitForOffset(Units, RefOffset);
+  if (RefCU)
     if (const auto RefDie = RefCU->getOrigUnit().getDIEForOffset(RefOffset)) {
       // In a file with broken references, an attribute might point to a NULL
       // DIE.
@@ -669,7 +676,7 @@ void DWARFLinker::lookForRefDIEsToKeep(
     Val.extractValue(Data, &Offset, Unit.getFormParams(), &Unit);
     CompileUnit *ReferencedCU;
     if (auto RefDie =
-            resolveDIEReference(File, Units, Val, Die, ReferencedCU)) {
+            resolveDIEReference(File, Units, Val, Die, CU, ReferencedCU)) {
       CompileUnit::DIEInfo &Info = ReferencedCU->getInfo(RefDie);
       // If the referenced DIE has a DeclContext that has already been
       // emitted, then do not keep the one in this CU. We'll link to
@@ -913,7 +920,8 @@ unsigned DWARFLinker::DIECloner::cloneDieReferenceAttribute(
   CompileUnit *RefUnit = nullptr;
 
   DWARFDie RefDie =
-      Linker.resolveDIEReference(File, CompileUnits, Val, InputDIE, RefUnit);
+      Linker.resolveDIEReference(File, CompileUnits, Val, InputDIE, Unit,
+                                 RefUnit);
 
   // If the referenced DIE is not found,  drop the attribute.
   if (!RefDie || AttrSpec.Attr == dwarf::DW_AT_sibling)
@@ -1972,8 +1980,8 @@ uint32_t DWARFLinker::DIECloner::hashFullyQualifiedName(DWARFDie DIE,
       break;
 
     CompileUnit *RefCU;
-    if (auto RefDIE =
-            Linker.resolveDIEReference(File, CompileUnits, *Ref, DIE, RefCU)) {
+    if (auto RefDIE = Linker.resolveDIEReference(File, CompileUnits, *Ref, DIE,
+                                                 *CU, RefCU)) {
       CU = RefCU;
       OrigUnit = &RefCU->getOrigUnit();
       DIE = RefDIE;
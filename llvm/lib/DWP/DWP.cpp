@@ -18,6 +18,7 @@
 #include "llvm/Object/Decompressor.h"
 #include "llvm/Object/ELFObjectFile.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include <limits>
 
 using namespace llvm;
@@ -584,13 +585,32 @@ Error write(MCStreamer &Out, ArrayRef<std::string> Inputs) {
 
   std::deque<SmallString<32>> UncompressedSections;
 
-  for (const auto &Input : Inputs) {
-    auto ErrOrObj = object::ObjectFile::createObjectFile(Input);
-    if (!ErrOrObj)
-      return ErrOrObj.takeError();
-
-    auto &Obj = *ErrOrObj->getBinary();
-    Objects.push_back(std::move(*ErrOrObj));
+  // Read and parse all input files up front. With large numbers of .dwo files
+  // this dominates packaging time, and each file can be loaded independently;
+  // the section data is still streamed to the output serially below.
+  struct LoadedInput {
+    Optional<OwningBinary<object::ObjectFile>> Obj;
+    Error Err = Error::success();
+  };
+  std::vector<LoadedInput> LoadedInputs(Inputs.size());
+  parallelFor(0, Inputs.size(), [&](size_t I) {
+    auto ErrOrObj = object::ObjectFile::createObjectFile(Inputs[I]);
+    if (ErrOrObj)
+      LoadedInputs[I].Obj = std::move(*ErrOrObj);
+    else
+      LoadedInputs[I].Err = ErrOrObj.takeError();
+  });
+  // Consume all load errors, reporting them in input order.
+  Error LoadErr = Error::success();
+  for (LoadedInput &Loaded : LoadedInputs)
+    LoadErr = joinErrors(std::move(LoadErr), std::move(Loaded.Err));
+  if (LoadErr)
+    return LoadErr;
+
+  for (size_t InputIdx = 0; InputIdx != Inputs.size(); ++InputIdx) {
+    const std::string &Input = Inputs[InputIdx];
+    auto &Obj = *LoadedInputs[InputIdx].Obj->getBinary();
+    Objects.push_back(std::move(*LoadedInputs[InputIdx].Obj));
 
     UnitIndexEntry CurEntry = {};
 
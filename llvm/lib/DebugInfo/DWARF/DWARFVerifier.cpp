@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #include "llvm/DebugInfo/DWARF/DWARFVerifier.h"
 #include "llvm/ADT/IntervalMap.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/DebugInfo/DWARF/DWARFAbbreviationDeclaration.h"
@@ -748,7 +749,7 @@ unsigned DWARFVerifier::verifyDebugInfoForm(const DWARFDie &Die,
       } else {
         // Valid reference, but we will verify it points to an actual
         // DIE later.
-        LocalReferences[*RefVal].insert(Die.getOffset());
+        LocalReferences[*RefVal].push_back(Die.getOffset());
       }
     }
     break;
@@ -767,7 +768,7 @@ unsigned DWARFVerifier::verifyDebugInfoForm(const DWARFDie &Die,
       } else {
         // Valid reference, but we will verify it points to an actual
         // DIE later.
-        CrossUnitReferences[*RefVal].insert(Die.getOffset());
+        CrossUnitReferences[*RefVal].push_back(Die.getOffset());
       }
     }
     break;
@@ -800,14 +801,20 @@ unsigned DWARFVerifier::verifyDebugInfoReferences(
     return DWARFDie();
   };
   unsigned NumErrors = 0;
-  for (const std::pair<const uint64_t, std::set<uint64_t>> &Pair :
+  for (const std::pair<const uint64_t, std::vector<uint64_t>> &Pair :
        References) {
     if (GetDIEForOffset(Pair.first))
       continue;
     ++NumErrors;
     error() << "invalid DIE reference " << format("0x%08" PRIx64, Pair.first)
             << ". Offset is in between DIEs:\n";
-    for (auto Offset : Pair.second)
+    // The referencing offsets are gathered unsorted and may repeat when one
+    // DIE references the offset through several attributes; report each
+    // referencing DIE once, in offset order.
+    std::vector<uint64_t> Offsets(Pair.second);
+    llvm::sort(Offsets);
+    Offsets.erase(std::unique(Offsets.begin(), Offsets.end()), Offsets.end());
+    for (auto Offset : Offsets)
       dump(GetDIEForOffset(Offset)) << '\n';
     OS << "\n";
   }
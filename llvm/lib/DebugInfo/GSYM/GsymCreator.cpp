@@ -10,6 +10,7 @@
 #include "llvm/DebugInfo/GSYM/Header.h"
 #include "llvm/DebugInfo/GSYM/LineTable.h"
 #include "llvm/MC/StringTableBuilder.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <algorithm>
@@ -194,8 +195,11 @@ llvm::Error GsymCreator::finalize(llvm::raw_ostream &OS) {
     return createStringError(std::errc::invalid_argument, "already finalized");
   Finalized = true;
 
-  // Sort function infos so we can emit sorted functions.
-  llvm::sort(Funcs);
+  // Sort function infos so we can emit sorted functions. FunctionInfo entries
+  // own line tables and inline info, so moving them around is expensive
+  // enough to be worth sorting in parallel; the converters that produced them
+  // have already released their threads by this point.
+  llvm::parallelSort(Funcs.begin(), Funcs.end());
 
   // Don't let the string table indexes change by finalizing in order.
   StrTab.finalizeInOrder();
@@ -235,6 +235,8 @@ void LLVMSymbolizer::flush() {
   ObjectForUBPathAndArch.clear();
   LRUBinaries.clear();
   CacheSize = 0;
+  LastBinary = nullptr;
+  LastBinaryPath.clear();
   BinaryForPath.clear();
   ObjectPairForPathArch.clear();
   Modules.clear();
@@ -617,7 +619,11 @@ LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
 
   auto I = Modules.find(ModuleName);
   if (I != Modules.end()) {
-    recordAccess(BinaryForPath.find(BinaryName)->second);
+    if (!LastBinary || LastBinaryPath != BinaryName) {
+      LastBinary = &BinaryForPath.find(BinaryName)->second;
+      LastBinaryPath = BinaryName;
+    }
+    recordAccess(*LastBinary);
     return I->second.get();
   }
 
@@ -760,6 +766,11 @@ void LLVMSymbolizer::pruneCache() {
     CachedBinary &Bin = LRUBinaries.front();
     CacheSize -= Bin.size();
     LRUBinaries.pop_front();
+    // Evicting erases the BinaryForPath node the memoized pointer refers to.
+    if (LastBinary == &Bin) {
+      LastBinary = nullptr;
+      LastBinaryPath.clear();
+    }
     Bin.evict();
   }
 }
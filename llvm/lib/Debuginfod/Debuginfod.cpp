@@ -85,6 +85,21 @@ std::chrono::milliseconds getDefaultDebuginfodTimeout() {
   return std::chrono::milliseconds(90 * 1000);
 }
 
+/// Returns the pruning policy for the debuginfod client cache, first checking
+/// DEBUGINFOD_CACHE_POLICY for a policy string as understood by
+/// parseCachePruningPolicy. Malformed policy strings are ignored, like a
+/// malformed DEBUGINFOD_TIMEOUT.
+static CachePruningPolicy getDefaultDebuginfodCachePruningPolicy() {
+  if (const char *PolicyEnv = std::getenv("DEBUGINFOD_CACHE_POLICY")) {
+    Expected<CachePruningPolicy> PolicyOrErr =
+        parseCachePruningPolicy(PolicyEnv);
+    if (PolicyOrErr)
+      return *PolicyOrErr;
+    consumeError(PolicyOrErr.takeError());
+  }
+  return CachePruningPolicy();
+}
+
 /// The following functions fetch a debuginfod artifact to a file in a local
 /// cache and return the cached file path. They first search the local cache,
 /// followed by the debuginfod servers.
@@ -219,6 +234,11 @@ Expected<std::string> getCachedOrDownloadArtifact(
     if (Client.responseCode() != 200)
       continue;
 
+    // The cache only grows when a download succeeds, so this is the one spot
+    // that needs to keep it within policy. pruneCache rate-limits itself
+    // through a timestamp file, making this a single stat() on most fetches.
+    pruneCache(CacheDirectoryPath, getDefaultDebuginfodCachePruningPolicy());
+
     // Return the path to the artifact on disk.
     return std::string(AbsCachedArtifactPath);
   }
@@ -26,6 +26,12 @@ static bool isDLangEncoding(const std::string &MangledName) {
          MangledName[1] == 'D';
 }
 
+static bool isMicrosoftEncoding(const char *S) {
+  // Microsoft mangled symbols start with '?'; '.' introduces the typeinfo
+  // name strings stored in RTTI data, which the demangler also accepts.
+  return S[0] == '?' || S[0] == '.';
+}
+
 std::string llvm::demangle(const std::string &MangledName) {
   std::string Result;
   const char *S = MangledName.c_str();
@@ -36,11 +42,16 @@ std::string llvm::demangle(const std::string &MangledName) {
   if (S[0] == '_' && nonMicrosoftDemangle(S + 1, Result))
     return Result;
 
-  if (char *Demangled =
-          microsoftDemangle(S, nullptr, nullptr, nullptr, nullptr)) {
-    Result = Demangled;
-    std::free(Demangled);
-    return Result;
+  // Only hand plausible candidates to the Microsoft demangler: it sets up a
+  // fresh arena per call, which is wasted work for the plain C symbols that
+  // dominate bulk demangling.
+  if (isMicrosoftEncoding(S)) {
+    if (char *Demangled =
+            microsoftDemangle(S, nullptr, nullptr, nullptr, nullptr)) {
+      Result = Demangled;
+      std::free(Demangled);
+      return Result;
+    }
   }
 
   return MangledName;
@@ -361,8 +361,10 @@ void InProcessMemoryManager::allocate(const JITLinkDylib *JD, LinkGraph &G,
       return;
     }
 
-    // Zero-fill the whole slab up-front.
-    memset(Slab.base(), 0, Slab.allocatedSize());
+    // The slab is a freshly mapped anonymous region, which the OS guarantees
+    // to be zero-filled, so zero-fill segments need no explicit memset here.
+    // Touching the whole slab would fault in and dirty every page, committing
+    // physical memory even for ranges that are only ever read as zeros.
 
     StandardSegsMem = {Slab.base(),
                        static_cast<size_t>(SegsSizes->StandardSegs)};
@@ -240,9 +240,14 @@ Error DynamicLibrarySearchGenerator::tryToGenerate(
     LookupState &LS, LookupKind K, JITDylib &JD,
     JITDylibLookupFlags JDLookupFlags, const SymbolLookupSet &Symbols) {
   orc::SymbolMap NewSymbols;
+  NewSymbols.reserve(Symbols.size());
 
   bool HasGlobalPrefix = (GlobalPrefix != '\0');
 
+  // Reused across iterations to avoid a heap allocation per symbol when
+  // lookups arrive in large batches.
+  std::string Tmp;
+
   for (auto &KV : Symbols) {
     auto &Name = KV.first;
 
@@ -255,8 +260,8 @@ Error DynamicLibrarySearchGenerator::tryToGenerate(
     if (HasGlobalPrefix && (*Name).front() != GlobalPrefix)
       continue;
 
-    std::string Tmp((*Name).data() + HasGlobalPrefix,
-                    (*Name).size() - HasGlobalPrefix);
+    Tmp.assign((*Name).data() + HasGlobalPrefix,
+               (*Name).size() - HasGlobalPrefix);
     if (void *Addr = Dylib.getAddressOfSymbol(Tmp.c_str())) {
       NewSymbols[Name] = JITEvaluatedSymbol(
           static_cast<JITTargetAddress>(reinterpret_cast<uintptr_t>(Addr)),
@@ -0,0 +1,106 @@
+//===------- OnDiskObjectCache.cpp - Persistent object cache --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/Orc/OnDiskObjectCache.h"
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA256.h"
+#include "llvm/Support/raw_ostream.h"
+
+namespace llvm {
+namespace orc {
+
+Expected<std::unique_ptr<OnDiskObjectCache>>
+OnDiskObjectCache::Create(StringRef CacheDir, StringRef KeySalt) {
+  if (auto EC = sys::fs::create_directories(CacheDir))
+    return createStringError(EC, "cannot create object cache directory '%s'",
+                             CacheDir.str().c_str());
+  return std::unique_ptr<OnDiskObjectCache>(
+      new OnDiskObjectCache(CacheDir.str(), KeySalt.str()));
+}
+
+std::string OnDiskObjectCache::getCacheKey(const Module &M) const {
+  SmallVector<char, 0> Bitcode;
+  {
+    raw_svector_ostream BCStream(Bitcode);
+    WriteBitcodeToFile(M, BCStream);
+  }
+
+  SHA256 Hasher;
+  Hasher.update(KeySalt);
+  Hasher.update(
+      arrayRefFromStringRef(StringRef(Bitcode.data(), Bitcode.size())));
+  return toHex(Hasher.final(), /*LowerCase=*/true);
+}
+
+SmallString<128> OnDiskObjectCache::getPathForKey(StringRef Key) const {
+  SmallString<128> Path(CacheDir);
+  sys::path::append(Path, Twine(Key) + ".o");
+  return Path;
+}
+
+std::unique_ptr<MemoryBuffer> OnDiskObjectCache::getObject(const Module *M) {
+  std::string Key = getCacheKey(*M);
+  SmallString<128> Path = getPathForKey(Key);
+
+  {
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    Keys[M] = std::move(Key);
+  }
+
+  // Map the cached object if present. Cache misses are expected, so any
+  // failure to open the file is just a miss.
+  auto Buffer = MemoryBuffer::getFile(Path, /*IsText=*/false,
+                                      /*RequiresNullTerminator=*/false);
+  if (!Buffer)
+    return nullptr;
+  return std::move(*Buffer);
+}
+
+void OnDiskObjectCache::notifyObjectCompiled(const Module *M,
+                                             MemoryBufferRef Obj) {
+  std::string Key;
+  {
+    std::lock_guard<std::mutex> Lock(KeysMutex);
+    auto I = Keys.find(M);
+    if (I != Keys.end()) {
+      Key = std::move(I->second);
+      Keys.erase(I);
+    }
+  }
+  if (Key.empty())
+    Key = getCacheKey(*M);
+
+  // Write to a unique temporary in the cache directory and rename it into
+  // place so concurrent writers (and crashes) never expose a partial object.
+  SmallString<128> TempModel(CacheDir);
+  sys::path::append(TempModel, Key + ".tmp.%%%%%%");
+  SmallString<128> TempPath;
+  int TempFD;
+  if (sys::fs::createUniqueFile(TempModel, TempFD, TempPath))
+    return;
+  {
+    raw_fd_ostream OS(TempFD, /*shouldClose=*/true);
+    OS << Obj.getBuffer();
+    if (OS.has_error()) {
+      OS.clear_error();
+      sys::fs::remove(TempPath);
+      return;
+    }
+  }
+  if (sys::fs::rename(TempPath, getPathForKey(Key)))
+    sys::fs::remove(TempPath);
+}
+
+} // end namespace orc
+} // end namespace llvm
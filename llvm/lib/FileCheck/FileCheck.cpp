@@ -1295,8 +1295,19 @@ Pattern::MatchResult Pattern::match(StringRef Buffer,
   unsigned int Flags = Regex::Newline;
   if (IgnoreCase)
     Flags |= Regex::IgnoreCase;
-  if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
-    return make_error<NotFoundError>();
+  if (!Substitutions.empty()) {
+    // The regex text depends on the substituted values, so it has to be
+    // compiled fresh for every match attempt.
+    if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
+      return make_error<NotFoundError>();
+  } else {
+    // Substitution-free patterns always match against the same regex text;
+    // compile it once and reuse it across match attempts.
+    if (!CompiledRegEx)
+      CompiledRegEx.emplace(RegExToMatch, Flags);
+    if (!CompiledRegEx->match(Buffer, &MatchInfo))
+      return make_error<NotFoundError>();
+  }
 
   // Successful regex match.
   assert(!MatchInfo.empty() && "Didn't get any match");
@@ -20,6 +20,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/FileCheck/FileCheck.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Regex.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
 #include <string>
@@ -680,6 +681,13 @@ class Pattern {
   /// Ignore case while matching if set to true.
   bool IgnoreCase = false;
 
+  /// Compiled regex for RegExStr, built lazily on first use. Only used for
+  /// patterns without substitutions, whose regex text does not change between
+  /// match attempts; CHECK-DAG and CHECK-NOT groups can match the same
+  /// pattern against the input many times, and recompiling it each time
+  /// dominates matching for long transcripts.
+  mutable Optional<Regex> CompiledRegEx;
+
 public:
   Pattern(Check::FileCheckType Ty, FileCheckPatternContext *Context,
           Optional<size_t> Line = None)
@@ -866,6 +866,11 @@ Constant *ConstantInt::getBool(Type *Ty, bool V) {
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
   // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
+  unsigned BitWidth = V.getBitWidth();
+  bool Cacheable = BitWidth <= 64 && V.getZExtValue() < 2;
+  if (Cacheable)
+    if (ConstantInt *CachedC = pImpl->SmallIntConstants[BitWidth][V.getBoolValue()])
+      return CachedC;
   std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
   if (!Slot) {
     // Get the corresponding integer type for the bit width of the value.
@@ -873,6 +878,8 @@ ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
     Slot.reset(new ConstantInt(ITy, V));
   }
   assert(Slot->getType() == IntegerType::get(Context, V.getBitWidth()));
+  if (Cacheable)
+    pImpl->SmallIntConstants[BitWidth][V.getBoolValue()] = Slot.get();
   return Slot.get();
 }
 
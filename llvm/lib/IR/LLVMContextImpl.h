@@ -1403,6 +1403,13 @@ public:
       DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>;
   IntMapTy IntConstants;
 
+  // Dedicated fast-path cache for the zero and one constants of integer types
+  // up to 64 bits wide. These are by far the most frequently requested
+  // constants (GEP indices, increments, comparisons against zero) and hitting
+  // here avoids hashing an APInt and probing IntConstants. The pointers are
+  // non-owning; the constants themselves live in IntConstants.
+  ConstantInt *SmallIntConstants[65][2] = {};
+
   using FPMapTy =
       DenseMap<APFloat, std::unique_ptr<ConstantFP>, DenseMapAPFloatKeyInfo>;
   FPMapTy FPConstants;
@@ -511,6 +511,33 @@ void Value::doRAUW(Value *New, ReplaceMetadataUses ReplaceMetaUses) {
   if (ReplaceMetaUses == ReplaceMetadataUses::Yes && isUsedByMetadata())
     ValueAsMetadata::handleRAUW(this, New);
 
+  // In the common case no user is a uniqued constant, so every use can be
+  // retargeted by rewriting Use::Val and splicing the whole use list onto New
+  // in one step, rather than unlinking and relinking each Use individually.
+  if (UseList) {
+    bool HasUniquedConstantUser = false;
+    for (const Use *U = UseList; U; U = U->Next)
+      if (auto *C = dyn_cast<Constant>(U->getUser()))
+        if (!isa<GlobalValue>(C)) {
+          HasUniquedConstantUser = true;
+          break;
+        }
+    if (!HasUniquedConstantUser) {
+      Use *Tail = UseList;
+      Tail->Val = New;
+      while (Tail->Next) {
+        Tail = Tail->Next;
+        Tail->Val = New;
+      }
+      Tail->Next = New->UseList;
+      if (Tail->Next)
+        Tail->Next->Prev = &Tail->Next;
+      UseList->Prev = &New->UseList;
+      New->UseList = UseList;
+      UseList = nullptr;
+    }
+  }
+
   while (!materialized_use_empty()) {
     Use &U = *UseList;
     // Must handle Constants specially, we cannot call replaceUsesOfWith on a
@@ -48,7 +48,9 @@
 #include "llvm/ADT/APInt.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallPtrSet.h"
@@ -336,6 +338,12 @@ class Verifier : public InstVisitor<Verifier>, VerifierSupport {
   /// Cache of attribute lists verified.
   SmallPtrSet<const void *, 32> AttributeListsVisited;
 
+  /// Cache of (function type, attribute list, flags) combinations that
+  /// verified cleanly. Both components are uniqued, and a large function
+  /// re-verifies the same callee signature at every call site.
+  DenseSet<std::pair<const FunctionType *, std::pair<const void *, unsigned>>>
+      VerifiedFunctionAttrs;
+
   // Verify that this GlobalValue is only used in this module.
   // This map is used to avoid visiting uses twice. We can arrive at a user
   // twice, if they have multiple operands. In particular for very large
@@ -1915,6 +1923,19 @@ void Verifier::verifyFunctionAttrs(FunctionType *FT, AttributeList Attrs,
   if (Attrs.isEmpty())
     return;
 
+  // The checks below depend only on the function type, the attribute list and
+  // the two flags; V appears in diagnostics alone. Skip combinations that have
+  // already verified cleanly, and record the current one on exit unless a
+  // check failed. Once the module is known broken there is no point caching.
+  std::pair<const FunctionType *, std::pair<const void *, unsigned>> CacheKey(
+      FT, {Attrs.getRawPointer(), unsigned(IsIntrinsic) | IsInlineAsm << 1});
+  if (VerifiedFunctionAttrs.count(CacheKey))
+    return;
+  auto RecordIfClean = make_scope_exit([&] {
+    if (!Broken)
+      VerifiedFunctionAttrs.insert(CacheKey);
+  });
+
   if (AttributeListsVisited.insert(Attrs.getRawPointer()).second) {
     Check(Attrs.hasParentContext(Context),
           "Attribute list does not match Module context!", &Attrs, V);
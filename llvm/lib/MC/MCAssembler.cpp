@@ -8,6 +8,7 @@
 
 #include "llvm/MC/MCAssembler.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
@@ -806,6 +807,25 @@ MCAssembler::handleFixup(const MCAsmLayout &Layout, MCFragment &F,
   return std::make_tuple(Target, FixedValue, IsResolved);
 }
 
+/// Check whether \p F is of a kind that relaxFragment() could resize. The
+/// kind of a fragment never changes once the streamer has emitted it, so
+/// this predicate is stable across layout iterations.
+static bool fragmentCanRelax(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout(MCAsmLayout &Layout) {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump", {
@@ -833,8 +853,19 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
       Frag.setLayoutOrder(FragmentIndex++);
   }
 
+  // Sections without any fragment a layout iteration could resize can never
+  // trigger relaxation, so compute the set of sections that can up front
+  // rather than rescanning every fragment of every section on each pass.
+  // Relaxation changes the contents of fragments but never their kind, so
+  // the set is stable across iterations. Machine-generated assembly commonly
+  // has no relaxable fragments at all.
+  SmallVector<MCSection *, 16> RelaxableSections;
+  for (MCSection &Sec : *this)
+    if (llvm::any_of(Sec, fragmentCanRelax))
+      RelaxableSections.push_back(&Sec);
+
   // Layout until everything fits.
-  while (layoutOnce(Layout)) {
+  while (layoutOnce(Layout, RelaxableSections)) {
     if (getContext().hadError())
       return;
     // Size of fragments in one section can depend on the size of fragments in
@@ -1212,12 +1243,13 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout,
+                             ArrayRef<MCSection *> RelaxableSections) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
-  for (MCSection &Sec : *this) {
-    while (layoutSectionOnce(Layout, Sec))
+  for (MCSection *Sec : RelaxableSections) {
+    while (layoutSectionOnce(Layout, *Sec))
       WasRelaxed = true;
   }
 
@@ -615,22 +615,22 @@ InstrBuilder::createInstrDescImpl(const MCInst &MCI) {
 
   // Now add the new descriptor.
   bool IsVariadic = MCDesc.isVariadic();
-  if ((ID->IsRecyclable = !IsVariadic && !IsVariant)) {
-    Descriptors[MCI.getOpcode()] = std::move(ID);
-    return *Descriptors[MCI.getOpcode()];
-  }
+  if ((ID->IsRecyclable = !IsVariadic && !IsVariant))
+    return *Descriptors.try_emplace(MCI.getOpcode(), std::move(ID))
+                .first->second;
 
-  VariantDescriptors[&MCI] = std::move(ID);
-  return *VariantDescriptors[&MCI];
+  return *VariantDescriptors.try_emplace(&MCI, std::move(ID)).first->second;
 }
 
 Expected<const InstrDesc &>
 InstrBuilder::getOrCreateInstrDesc(const MCInst &MCI) {
-  if (Descriptors.find_as(MCI.getOpcode()) != Descriptors.end())
-    return *Descriptors[MCI.getOpcode()];
+  auto DI = Descriptors.find_as(MCI.getOpcode());
+  if (DI != Descriptors.end())
+    return *DI->second;
 
-  if (VariantDescriptors.find(&MCI) != VariantDescriptors.end())
-    return *VariantDescriptors[&MCI];
+  auto VDI = VariantDescriptors.find(&MCI);
+  if (VDI != VariantDescriptors.end())
+    return *VDI->second;
 
   return createInstrDescImpl(MCI);
 }
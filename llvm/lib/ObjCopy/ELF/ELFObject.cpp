@@ -2044,6 +2044,23 @@ template <class ELFT> Error ELFWriter<ELFT>::writeSectionData() {
 template <class ELFT> void ELFWriter<ELFT>::writeSegmentData() {
   for (Segment &Seg : Obj.segments()) {
     size_t Size = std::min<size_t>(Seg.FileSize, Seg.getContents().size());
+    // A segment nested in another segment covers a subrange of its bytes. If
+    // layout kept this segment at the same position relative to the topmost
+    // segment containing it, the copy of the topmost segment's contents below
+    // already produces exactly these bytes, and re-copying them is wasted
+    // memory traffic. Executables commonly shadow most of a PT_LOAD with
+    // PT_DYNAMIC, PT_NOTE, PT_GNU_* and similar segments, so for a plain
+    // strip this used to copy much of the file twice.
+    const Segment *Top = Seg.ParentSegment;
+    while (Top != nullptr && Top->ParentSegment != nullptr)
+      Top = Top->ParentSegment;
+    if (Top != nullptr) {
+      size_t TopSize =
+          std::min<size_t>(Top->FileSize, Top->getContents().size());
+      uint64_t OrigDelta = Seg.OriginalOffset - Top->OriginalOffset;
+      if (Seg.Offset == Top->Offset + OrigDelta && OrigDelta + Size <= TopSize)
+        continue;
+    }
     std::memcpy(Buf->getBufferStart() + Seg.Offset, Seg.getContents().data(),
                 Size);
   }
@@ -574,7 +574,13 @@ Expected<StringRef> Archive::Child::getBuffer() const {
   if (!FullNameOrErr)
     return FullNameOrErr.takeError();
   const std::string &FullName = *FullNameOrErr;
-  ErrorOr<std::unique_ptr<MemoryBuffer>> Buf = MemoryBuffer::getFile(FullName);
+  // Members are object or bitcode files consumed through size-bounded
+  // buffers, so don't require a null terminator; requiring one forces the
+  // whole file to be read eagerly instead of mmapped whenever its size is an
+  // exact multiple of the page size.
+  ErrorOr<std::unique_ptr<MemoryBuffer>> Buf =
+      MemoryBuffer::getFile(FullName, /*IsText=*/false,
+                            /*RequiresNullTerminator=*/false);
   if (std::error_code EC = Buf.getError())
     return errorCodeToError(EC);
   Parent->ThinBuffers.push_back(std::move(*Buf));
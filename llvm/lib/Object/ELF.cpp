@@ -9,6 +9,7 @@
 #include "llvm/Object/ELF.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/MathExtras.h"
 
 using namespace llvm;
 using namespace object;
@@ -349,9 +350,23 @@ ELFFile<ELFT>::decode_relrs(Elf_Relr_Range relrs) const {
   // Word type: uint32_t for Elf32, and uint64_t for Elf64.
   using Addr = typename ELFT::uint;
 
+  // An address entry emits one relocation and a bitmap entry one per set bit
+  // (excluding the tag bit), so the exact output size is a cheap scan away.
+  // Dynamic binaries pack hundreds of thousands of relative relocations into
+  // SHT_RELR; size the vector once instead of growing it.
+  size_t NumRelocs = 0;
+  for (Elf_Relr R : relrs) {
+    Addr Entry = R;
+    if ((Entry & 1) == 0)
+      ++NumRelocs;
+    else
+      NumRelocs += llvm::countPopulation(Entry) - 1;
+  }
+  Relocs.reserve(NumRelocs);
+
   Addr Base = 0;
   for (Elf_Relr R : relrs) {
-    typename ELFT::uint Entry = R;
+    Addr Entry = R;
     if ((Entry & 1) == 0) {
       // Even entry: encodes the offset for next relocation.
       Rel.r_offset = Entry;
@@ -359,12 +374,13 @@ ELFFile<ELFT>::decode_relrs(Elf_Relr_Range relrs) const {
       // Set base offset for subsequent bitmap entries.
       Base = Entry + sizeof(Addr);
     } else {
-      // Odd entry: encodes bitmap for relocations starting at base.
-      for (Addr Offset = Base; (Entry >>= 1) != 0; Offset += sizeof(Addr))
-        if ((Entry & 1) != 0) {
-          Rel.r_offset = Offset;
-          Relocs.push_back(Rel);
-        }
+      // Odd entry: encodes bitmap for relocations starting at base. Iterate
+      // over the set bits directly; bitmaps are often sparse.
+      for (Addr Bits = Entry >> 1; Bits != 0; Bits &= Bits - 1) {
+        Rel.r_offset =
+            Base + uint64_t(llvm::countTrailingZeros(Bits)) * sizeof(Addr);
+        Relocs.push_back(Rel);
+      }
       Base += (CHAR_BIT * sizeof(Entry) - 1) * sizeof(Addr);
     }
   }
@@ -231,7 +231,7 @@ static unsigned getMaxCounterID(const CounterMappingContext &Ctx,
 
 Error CoverageMapping::loadFunctionRecord(
     const CoverageMappingRecord &Record,
-    IndexedInstrProfReader &ProfileReader) {
+    IndexedInstrProfReader &ProfileReader, FilenamesHashCache &HashCache) {
   StringRef OrigFuncName = Record.FunctionName;
   if (OrigFuncName.empty())
     return make_error<CoverageMapError>(coveragemap_error::malformed);
@@ -283,10 +283,23 @@ Error CoverageMapping::loadFunctionRecord(
     Function.pushRegion(Region, *ExecutionCount, *AltExecutionCount);
   }
 
+  // Get the hashes for the record's filename array, computing them if this is
+  // the first record referencing that array.
+  auto HashesInsert = HashCache.try_emplace(
+      std::make_pair(Record.Filenames.data(), Record.Filenames.size()));
+  FilenamesHashes &Hashes = HashesInsert.first->second;
+  if (HashesInsert.second) {
+    Hashes.CombinedHash =
+        hash_combine_range(Record.Filenames.begin(), Record.Filenames.end());
+    Hashes.PerFilenameHashes.reserve(Record.Filenames.size());
+    for (StringRef Filename : Record.Filenames)
+      Hashes.PerFilenameHashes.push_back(hash_value(Filename));
+  }
+
   // Don't create records for (filenames, function) pairs we've already seen.
-  auto FilenamesHash = hash_combine_range(Record.Filenames.begin(),
-                                          Record.Filenames.end());
-  if (!RecordProvenance[FilenamesHash].insert(hash_value(OrigFuncName)).second)
+  if (!RecordProvenance[Hashes.CombinedHash]
+           .insert(hash_value(OrigFuncName))
+           .second)
     return Error::success();
 
   Functions.push_back(std::move(Function));
@@ -295,8 +308,8 @@ Error CoverageMapping::loadFunctionRecord(
   // which correspond to each filename. This can be used to substantially speed
   // up queries for coverage info in a file.
   unsigned RecordIndex = Functions.size() - 1;
-  for (StringRef Filename : Record.Filenames) {
-    auto &RecordIndices = FilenameHash2RecordIndices[hash_value(Filename)];
+  for (size_t FilenameHash : Hashes.PerFilenameHashes) {
+    auto &RecordIndices = FilenameHash2RecordIndices[FilenameHash];
     // Note that there may be duplicates in the filename set for a function
     // record, because of e.g. macro expansions in the function in which both
     // the macro and the function are defined in the same file.
@@ -312,12 +325,16 @@ Error CoverageMapping::loadFunctionRecord(
 Error CoverageMapping::loadFromReaders(
     ArrayRef<std::unique_ptr<CoverageMappingReader>> CoverageReaders,
     IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage) {
+  // The cached hashes refer into the readers' filename storage, so the cache
+  // must not outlive the readers.
+  FilenamesHashCache HashCache;
   for (const auto &CoverageReader : CoverageReaders) {
     for (auto RecordOrErr : *CoverageReader) {
       if (Error E = RecordOrErr.takeError())
         return E;
       const auto &Record = *RecordOrErr;
-      if (Error E = Coverage.loadFunctionRecord(Record, ProfileReader))
+      if (Error E =
+              Coverage.loadFunctionRecord(Record, ProfileReader, HashCache))
         return E;
     }
   }
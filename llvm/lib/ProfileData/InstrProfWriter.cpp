@@ -249,8 +249,10 @@ void InstrProfWriter::addRecord(StringRef Name, uint64_t Hash,
     // We're updating a function we've seen before.
     Dest.merge(I, Weight, MapWarn);
   }
-
-  Dest.sortValueData();
+  // Note that the value profile data is not kept sorted by count here; it is
+  // sorted once in writeImpl. Merging re-sorts the data by target value, so
+  // sorting it on every call would just be thrown-away work when many
+  // profiles are merged into the same record.
 }
 
 void InstrProfWriter::addMemProfRecord(
@@ -338,6 +340,13 @@ Error InstrProfWriter::writeImpl(ProfOStream &OS) {
   InstrProfSummaryBuilder CSISB(ProfileSummaryBuilder::DefaultCutoffs);
   InfoObj->CSSummaryBuilder = &CSISB;
 
+  // The on-disk format expects the value profile data of each site to be
+  // sorted by count. addRecord does not maintain that order while merging,
+  // so establish it here, once per function.
+  for (auto &I : FunctionData)
+    for (auto &Func : I.getValue())
+      Func.second.sortValueData();
+
   // Populate the hash table generator.
   for (const auto &I : FunctionData)
     if (shouldEncodeData(I.getValue()))
@@ -596,6 +605,12 @@ Error InstrProfWriter::writeText(raw_fd_ostream &OS) {
     OS << "# Always instrument the function entry block\n:entry_first\n";
   InstrProfSymtab Symtab;
 
+  // As in writeImpl, establish the by-count order of each site's value
+  // profile data that addRecord no longer maintains while merging.
+  for (auto &I : FunctionData)
+    for (auto &Func : I.getValue())
+      Func.second.sortValueData();
+
   using FuncPair = detail::DenseMapPair<uint64_t, InstrProfRecord>;
   using RecordType = std::pair<StringRef, FuncPair>;
   SmallVector<RecordType, 4> OrderedFuncData;
@@ -903,18 +903,33 @@ std::error_code SampleProfileReaderExtBinaryBase::readFuncProfiles() {
           if (std::error_code EC = readFuncProfile(FuncProfileAddr))
             return EC;
         }
-      } else {
+      } else if (Remapper) {
+        // With a remapper, any profiled name may remap to a function in the
+        // current module, so walk the whole offset table.
         for (auto NameOffset : FuncOffsetTable) {
           SampleContext FContext(NameOffset.first);
           auto FuncName = FContext.getName();
-          if (!FuncsToUse.count(FuncName) &&
-              (!Remapper || !Remapper->exist(FuncName)))
+          if (!FuncsToUse.count(FuncName) && !Remapper->exist(FuncName))
             continue;
           const uint8_t *FuncProfileAddr = Start + NameOffset.second;
           assert(FuncProfileAddr < End && "out of LBRProfile section");
           if (std::error_code EC = readFuncProfile(FuncProfileAddr))
             return EC;
         }
+      } else {
+        // Without a remapper, only names in the current module can match, so
+        // look them up directly instead of scanning the whole offset table.
+        // The latter is proportional to the size of the profile rather than
+        // the size of the module.
+        for (auto Name : FuncsToUse) {
+          auto iter = FuncOffsetTable.find(Name);
+          if (iter == FuncOffsetTable.end())
+            continue;
+          const uint8_t *FuncProfileAddr = Start + iter->second;
+          assert(FuncProfileAddr < End && "out of LBRProfile section");
+          if (std::error_code EC = readFuncProfile(FuncProfileAddr))
+            return EC;
+        }
       }
     }
     Data = End;
@@ -36,12 +36,17 @@ Error RemarkStreamer::setFilter(StringRef Filter) {
     return createStringError(std::make_error_code(std::errc::invalid_argument),
                              RegexError.data());
   PassFilter = std::move(R);
+  PassFilterMatches.clear();
   return Error::success();
 }
 
 bool RemarkStreamer::matchesFilter(StringRef Str) {
-  if (PassFilter)
-    return PassFilter->match(Str);
+  if (PassFilter) {
+    auto Match = PassFilterMatches.try_emplace(Str, false);
+    if (Match.second)
+      Match.first->second = PassFilter->match(Str);
+    return Match.first->second;
+  }
   // No filter means all strings pass.
   return true;
 }
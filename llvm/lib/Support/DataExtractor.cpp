@@ -10,6 +10,7 @@
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/SwapByteOrder.h"
 
 using namespace llvm;
@@ -218,10 +219,31 @@ static T getLEB128(StringRef Data, uint64_t *OffsetPtr, Error *Err,
 }
 
 uint64_t DataExtractor::getULEB128(uint64_t *offset_ptr, Error *Err) const {
+  // Fast path for the single-byte encoding, which dominates real inputs
+  // (DWARF line programs and abbreviations encode almost every operand in
+  // one byte). The generic decoder's bounds and overflow handling is only
+  // needed for multi-byte values.
+  if (LLVM_LIKELY(*offset_ptr < Data.size() && !isError(Err))) {
+    uint8_t Byte = uint8_t(Data[*offset_ptr]);
+    if (LLVM_LIKELY(Byte < 0x80)) {
+      ErrorAsOutParameter ErrAsOut(Err);
+      ++*offset_ptr;
+      return Byte;
+    }
+  }
   return getLEB128(Data, offset_ptr, Err, decodeULEB128);
 }
 
 int64_t DataExtractor::getSLEB128(uint64_t *offset_ptr, Error *Err) const {
+  // See getULEB128: take the common single-byte encoding out of line.
+  if (LLVM_LIKELY(*offset_ptr < Data.size() && !isError(Err))) {
+    uint8_t Byte = uint8_t(Data[*offset_ptr]);
+    if (LLVM_LIKELY(Byte < 0x80)) {
+      ErrorAsOutParameter ErrAsOut(Err);
+      ++*offset_ptr;
+      return SignExtend64<7>(Byte);
+    }
+  }
   return getLEB128(Data, offset_ptr, Err, decodeSLEB128);
 }
 
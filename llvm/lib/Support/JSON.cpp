@@ -535,15 +535,24 @@ bool Parser::parseNumber(char First, Value &Out) {
 
 bool Parser::parseString(std::string &Out) {
   // leading quote was already consumed.
-  for (char C = next(); C != '"'; C = next()) {
+  for (;;) {
+    // Append the longest run without a quote, escape, or control character
+    // wholesale; for typical strings this is the entire content in one
+    // memcpy-style append rather than a push_back per byte.
+    const char *RunEnd = P;
+    while (RunEnd != End && *RunEnd != '"' && *RunEnd != '\\' &&
+           (*RunEnd & 0x1f) != *RunEnd)
+      ++RunEnd;
+    Out.append(P, RunEnd);
+    P = RunEnd;
+    char C = next();
+    if (C == '"')
+      return true;
     if (LLVM_UNLIKELY(P == End))
       return parseError("Unterminated string");
     if (LLVM_UNLIKELY((C & 0x1f) == C))
       return parseError("Control character in string");
-    if (LLVM_LIKELY(C != '\\')) {
-      Out.push_back(C);
-      continue;
-    }
+    assert(C == '\\' && "run should only stop at an escape");
     // Handle escape sequence.
     switch (C = next()) {
     case '"':
@@ -574,7 +583,6 @@ bool Parser::parseString(std::string &Out) {
       return parseError("Invalid escape sequence");
     }
   }
-  return true;
 }
 
 static void encodeUtf8(uint32_t Rune, std::string &Out) {
@@ -724,11 +732,21 @@ std::string fixUTF8(llvm::StringRef S) {
 
 static void quote(llvm::raw_ostream &OS, llvm::StringRef S) {
   OS << '\"';
-  for (unsigned char C : S) {
-    if (C == 0x22 || C == 0x5C)
-      OS << '\\';
-    if (C >= 0x20) {
-      OS << C;
+  while (!S.empty()) {
+    // Write the longest run that needs no escaping in one piece; most strings
+    // have none at all.
+    size_t Run = 0;
+    while (Run != S.size() && (unsigned char)S[Run] >= 0x20 &&
+           S[Run] != 0x22 && S[Run] != 0x5C)
+      ++Run;
+    OS << S.take_front(Run);
+    S = S.drop_front(Run);
+    if (S.empty())
+      break;
+    unsigned char C = S.front();
+    S = S.drop_front();
+    if (C == 0x22 || C == 0x5C) {
+      OS << '\\' << C;
       continue;
     }
     OS << '\\';
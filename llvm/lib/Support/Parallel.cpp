@@ -33,6 +33,10 @@ public:
   virtual ~Executor() = default;
   virtual void add(std::function<void()> func) = 0;
 
+  /// Run one queued task on the calling thread, if any is pending. Returns
+  /// false when the queue is empty.
+  virtual bool tryConsumeOneTask() = 0;
+
   static Executor *getDefaultExecutor();
 };
 
@@ -94,6 +98,17 @@ public:
     Cond.notify_one();
   }
 
+  bool tryConsumeOneTask() override {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    if (WorkStack.empty())
+      return false;
+    auto Task = std::move(WorkStack.top());
+    WorkStack.pop();
+    Lock.unlock();
+    Task();
+    return true;
+  }
+
 private:
   void work(ThreadPoolStrategy S, unsigned ThreadID) {
     S.apply_thread_strategy(ThreadID);
@@ -144,18 +159,15 @@ Executor *Executor::getDefaultExecutor() {
 }
 } // namespace
 
-static std::atomic<int> TaskGroupInstances;
-
-// Latch::sync() called by the dtor may cause one thread to block. If is a dead
-// lock if all threads in the default executor are blocked. To prevent the dead
-// lock, only allow the first TaskGroup to run tasks parallelly. In the scenario
-// of nested parallel_for_each(), only the outermost one runs parallelly.
-TaskGroup::TaskGroup() : Parallel(TaskGroupInstances++ == 0) {}
+// Nested task groups used to degrade to inline execution because a group
+// whose sync() merely blocked could deadlock the pool: with every worker
+// stuck in sync(), nobody was left to run the queued tasks. sync() now drains
+// the queue while it waits, so nested groups schedule onto the shared
+// executor like any other and only run inline on a single-threaded strategy.
+TaskGroup::TaskGroup() : Parallel(strategy.ThreadsRequested != 1) {}
 TaskGroup::~TaskGroup() {
-  // We must ensure that all the workloads have finished before decrementing the
-  // instances count.
-  L.sync();
-  --TaskGroupInstances;
+  // We must ensure that all the workloads have finished before destruction.
+  sync();
 }
 
 void TaskGroup::spawn(std::function<void()> F) {
@@ -170,6 +182,19 @@ void TaskGroup::spawn(std::function<void()> F) {
   }
 }
 
+void TaskGroup::sync() const {
+  // While this group's tasks are pending, execute queued work on the calling
+  // thread instead of just blocking it. A thread waiting on a nested group
+  // thereby runs its own subtasks (or someone else's), and a thread only
+  // blocks once the queue is empty, at which point every remaining task of
+  // this group is already running on some other thread. As a bonus, the
+  // thread that issued a parallel loop helps retire it rather than idling.
+  if (Parallel)
+    while (!L.isDone() && Executor::getDefaultExecutor()->tryConsumeOneTask())
+      ;
+  L.sync();
+}
+
 } // namespace detail
 } // namespace parallel
 } // namespace llvm
@@ -178,9 +203,7 @@ void TaskGroup::spawn(std::function<void()> F) {
 void llvm::parallelFor(size_t Begin, size_t End,
                        llvm::function_ref<void(size_t)> Fn) {
   // If we have zero or one items, then do not incur the overhead of spinning up
-  // a task group.  They are surprisingly expensive, and because they do not
-  // support nested parallelism, a single entry task group can block parallel
-  // execution underneath them.
+  // a task group.  They are surprisingly expensive.
 #if LLVM_ENABLE_THREADS
   auto NumItems = End - Begin;
   if (NumItems > 1 && parallel::strategy.ThreadsRequested != 1) {
@@ -37,6 +37,15 @@ bool SpecialCaseList::Matcher::insert(std::string Regexp,
     Strings[Regexp] = LineNumber;
     return true;
   }
+
+  // Entries that are a literal followed by a single trailing "*" (e.g.
+  // "src:/usr/include/*" rules) do not need a regex either: they match
+  // exactly the queries that start with the literal.
+  if (Regexp.back() == '*' && Regex::isLiteralERE(StringRef(Regexp).drop_back())) {
+    Prefixes.emplace(Regexp.substr(0, Regexp.size() - 1), LineNumber);
+    return true;
+  }
+
   Trigrams.insert(Regexp);
 
   // Replace * with .*
@@ -57,10 +66,35 @@ bool SpecialCaseList::Matcher::insert(std::string Regexp,
   return true;
 }
 
+unsigned SpecialCaseList::Matcher::matchPrefixes(StringRef Query) const {
+  if (Prefixes.empty())
+    return 0;
+  // Any prefix of Query compares less than or equal to Query, so search
+  // downwards from the upper bound. Whenever an entry diverges from Query,
+  // shrink Query to the part the two share: entries between them cannot be
+  // prefixes of Query and are skipped wholesale.
+  auto It = Prefixes.upper_bound(Query);
+  while (It != Prefixes.begin()) {
+    --It;
+    StringRef Prefix = It->first;
+    if (Query.startswith(Prefix))
+      return It->second;
+    size_t Shared = 0;
+    size_t Limit = std::min(Prefix.size(), Query.size());
+    while (Shared < Limit && Prefix[Shared] == Query[Shared])
+      ++Shared;
+    Query = Query.take_front(Shared);
+    It = Prefixes.upper_bound(Query);
+  }
+  return 0;
+}
+
 unsigned SpecialCaseList::Matcher::match(StringRef Query) const {
   auto It = Strings.find(Query);
   if (It != Strings.end())
     return It->second;
+  if (unsigned LineNumber = matchPrefixes(Query))
+    return LineNumber;
   if (Trigrams.isDefinitelyOut(Query))
     return false;
   for (const auto &RegExKV : RegExes)
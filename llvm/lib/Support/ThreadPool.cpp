@@ -36,6 +36,14 @@ ThreadPool::ThreadPool(ThreadPoolStrategy S)
     : Strategy(S), MaxThreadCount(S.compute_thread_count()) {}
 
 void ThreadPool::grow(int requested) {
+  {
+    // Fast path under the reader lock: once the pool has reached its maximum
+    // size it never shrinks, so enqueues on a fully grown pool do not need to
+    // serialize on the writer lock.
+    llvm::sys::ScopedReader LockGuard(ThreadsLock);
+    if (Threads.size() >= MaxThreadCount)
+      return; // Already hit the max thread pool size.
+  }
   llvm::sys::ScopedWriter LockGuard(ThreadsLock);
   if (Threads.size() >= MaxThreadCount)
     return; // Already hit the max thread pool size.
@@ -118,7 +126,11 @@ void ThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
           ActiveGroups.erase(A);
       }
       Notify = workCompletedUnlocked(GroupOfTask);
-      NotifyGroup = GroupOfTask != nullptr && Notify;
+      // Broadcasting on QueueCondition is only needed to wake up threads
+      // inside a recursive wait(); if there are none, skip it rather than
+      // rousing every idle worker on each group task completion.
+      NotifyGroup =
+          GroupOfTask != nullptr && Notify && RecursiveGroupWaiters != 0;
     }
     // Notify task completion if this is the last active thread, in case
     // someone waits on ThreadPool::wait().
@@ -162,7 +174,15 @@ void ThreadPool::wait(ThreadPoolTaskGroup &Group) {
   // Handle the case of recursive call from another task in a different group,
   // in which case process tasks while waiting to keep the thread busy and avoid
   // possible deadlock.
+  {
+    std::lock_guard<std::mutex> LockGuard(QueueLock);
+    ++RecursiveGroupWaiters;
+  }
   processTasks(&Group);
+  {
+    std::lock_guard<std::mutex> LockGuard(QueueLock);
+    --RecursiveGroupWaiters;
+  }
 }
 
 bool ThreadPool::isWorkerThread() const {
@@ -56,10 +56,10 @@ typedef std::pair<std::string, CountAndDurationType>
 
 namespace {
 struct Entry {
-  const TimePointType Start;
+  TimePointType Start;
   TimePointType End;
-  const std::string Name;
-  const std::string Detail;
+  std::string Name;
+  std::string Detail;
 
   Entry(TimePointType &&S, TimePointType &&E, std::string &&N, std::string &&Dt)
       : Start(std::move(S)), End(std::move(E)), Name(std::move(N)),
@@ -110,10 +110,6 @@ struct llvm::TimeTraceProfiler {
     // Calculate duration at full precision for overall counts.
     DurationType Duration = E.End - E.Start;
 
-    // Only include sections longer or equal to TimeTraceGranularity msec.
-    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
-      Entries.emplace_back(E);
-
     // Track total time taken by each "name", but only the topmost levels of
     // them; e.g. if there's a template instantiation that instantiates other
     // templates from within, we only want to add the topmost one. "topmost"
@@ -126,6 +122,12 @@ struct llvm::TimeTraceProfiler {
       CountAndTotal.second += Duration;
     }
 
+    // Only include sections longer or equal to TimeTraceGranularity msec.
+    // Steal the entry off the stack rather than copying its Name and Detail
+    // strings; this runs once per instrumented scope.
+    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
+      Entries.push_back(std::move(E));
+
     Stack.pop_back();
   }
 
@@ -205,7 +207,7 @@ struct llvm::TimeTraceProfiler {
     uint64_t TotalTid = MaxTid + 1;
     for (const NameAndCountAndDurationType &Total : SortedTotals) {
       auto DurUs = duration_cast<microseconds>(Total.second.second).count();
-      auto Count = AllCountAndTotalPerName[Total.first].first;
+      auto Count = Total.second.first;
 
       J.object([&] {
         J.attribute("pid", Pid);
@@ -2112,6 +2112,7 @@ RedirectingFileSystem::create(std::unique_ptr<MemoryBuffer> Buffer,
   if (!P.parse(Root, FS.get()))
     return nullptr;
 
+  FS->buildIndices();
   return FS;
 }
 
@@ -2165,6 +2166,7 @@ std::unique_ptr<RedirectingFileSystem> RedirectingFileSystem::create(
         std::move(NewFile));
   }
 
+  FS->buildIndices();
   return FS;
 }
 
@@ -2197,6 +2199,51 @@ RedirectingFileSystem::makeCanonical(SmallVectorImpl<char> &Path) const {
   return {};
 }
 
+void RedirectingFileSystem::DirectoryEntry::buildIndex(bool CaseSensitive) {
+  // Linear scans are cheap enough for small directories that an index is not
+  // worth its memory.
+  if (Contents.size() < 8)
+    return;
+  for (const std::unique_ptr<Entry> &Content : Contents) {
+    StringRef Name = Content->getName();
+    // Give up on names the by-name index cannot represent faithfully: empty
+    // names forward the lookup without consuming a component, names with
+    // separators only match as roots, and duplicates resolve to the first
+    // match in order. Such directories keep the linear scan.
+    if (Name.empty() || Name.contains('/') || Name.contains('\\') ||
+        !ContentsIndex
+             .try_emplace(CaseSensitive ? std::string(Name) : Name.lower(),
+                          Content.get())
+             .second) {
+      ContentsIndex.clear();
+      return;
+    }
+  }
+}
+
+RedirectingFileSystem::Entry *
+RedirectingFileSystem::DirectoryEntry::lookupIndexed(StringRef Name,
+                                                     bool CaseSensitive) const {
+  assert(hasIndex() && "only valid on indexed directories");
+  auto It = CaseSensitive ? ContentsIndex.find(Name)
+                          : ContentsIndex.find(Name.lower());
+  return It == ContentsIndex.end() ? nullptr : It->second;
+}
+
+void RedirectingFileSystem::buildIndices() {
+  SmallVector<Entry *, 16> Worklist;
+  for (const std::unique_ptr<Entry> &Root : Roots)
+    Worklist.push_back(Root.get());
+  while (!Worklist.empty()) {
+    if (auto *DE = dyn_cast<DirectoryEntry>(Worklist.pop_back_val())) {
+      DE->buildIndex(CaseSensitive);
+      for (const std::unique_ptr<Entry> &Content :
+           llvm::make_range(DE->contents_begin(), DE->contents_end()))
+        Worklist.push_back(Content.get());
+    }
+  }
+}
+
 ErrorOr<RedirectingFileSystem::LookupResult>
 RedirectingFileSystem::lookupPath(StringRef Path) const {
   sys::path::const_iterator Start = sys::path::begin(Path);
@@ -2240,6 +2287,15 @@ RedirectingFileSystem::lookupPathImpl(
     return LookupResult(From, Start, End);
 
   auto *DE = cast<RedirectingFileSystem::DirectoryEntry>(From);
+
+  // Large directories are indexed by child name; since the index covers all
+  // of the contents, a miss there is definitive.
+  if (DE->hasIndex()) {
+    if (Entry *Child = DE->lookupIndexed(*Start, CaseSensitive))
+      return lookupPathImpl(Start, End, Child);
+    return make_error_code(llvm::errc::no_such_file_or_directory);
+  }
+
   for (const std::unique_ptr<RedirectingFileSystem::Entry> &DirEntry :
        llvm::make_range(DE->contents_begin(), DE->contents_end())) {
     ErrorOr<RedirectingFileSystem::LookupResult> Result =
@@ -844,8 +844,11 @@ size_t raw_fd_ostream::preferred_buffer_size() const {
   // the complexity.
   if (S_ISCHR(statbuf.st_mode) && is_displayed())
     return 0;
-  // Return the preferred block size.
-  return statbuf.st_blksize;
+  // Return the preferred block size, but no less than 64 KiB. st_blksize is
+  // the device's natural write granularity (often 4 KiB), which is far below
+  // the point where syscall overhead amortizes; streaming a large artifact
+  // through a block-sized buffer costs a write(2) per block.
+  return std::max<size_t>(statbuf.st_blksize, 64 * 1024);
 #else
   return raw_ostream::preferred_buffer_size();
 #endif
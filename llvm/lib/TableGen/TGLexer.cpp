@@ -430,25 +430,28 @@ bool TGLexer::SkipCComment() {
   unsigned CommentDepth = 1;
 
   while (true) {
-    int CurChar = getNextChar();
-    switch (CurChar) {
-    case EOF:
+    // Skip to the next '*' or '/'; they are the only characters that can
+    // change the nesting depth. Everything in between is comment text.
+    size_t Pos = CurBuf.find_first_of("*/", CurPtr - CurBuf.data());
+    if (Pos == StringRef::npos) {
+      CurPtr = CurBuf.end();
       PrintError(TokStart, "Unterminated comment!");
       return true;
-    case '*':
+    }
+    CurPtr = CurBuf.data() + Pos + 1;
+    if (CurBuf[Pos] == '*') {
       // End of the comment?
-      if (CurPtr[0] != '/') break;
-
+      if (CurPtr[0] != '/')
+        continue;
       ++CurPtr;   // End the */.
       if (--CommentDepth == 0)
         return false;
-      break;
-    case '/':
+    } else {
       // Start of a nested comment?
-      if (CurPtr[0] != '*') break;
+      if (CurPtr[0] != '*')
+        continue;
       ++CurPtr;
       ++CommentDepth;
-      break;
     }
   }
 }
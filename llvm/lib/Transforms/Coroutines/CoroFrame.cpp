@@ -16,6 +16,7 @@
 
 #include "CoroInternal.h"
 #include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/PostOrderIterator.h"
 #include "llvm/ADT/ScopeExit.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/Analysis/PtrUseVisitor.h"
@@ -226,6 +227,23 @@ SuspendCrossingInfo::SuspendCrossingInfo(Function &F, coro::Shape &Shape)
       markSuspendBlock(Save);
   }
 
+  // Visit the blocks in reverse post order so that, in the common case,
+  // information flows from a block to its successors within a single pass and
+  // the fixpoint below is reached after very few iterations. Blocks that are
+  // unreachable from the entry are appended at the end so that they are still
+  // processed as before.
+  SmallVector<size_t, SmallVectorThreshold> Order;
+  Order.reserve(N);
+  BitVector Visited(N);
+  for (BasicBlock *BB : ReversePostOrderTraversal<Function *>(&F)) {
+    size_t BlockNo = Mapping.blockToIndex(BB);
+    Order.push_back(BlockNo);
+    Visited.set(BlockNo);
+  }
+  for (size_t I = 0; I < N; ++I)
+    if (!Visited.test(I))
+      Order.push_back(I);
+
   // Iterate propagating consumes and kills until they stop changing.
   int Iteration = 0;
   (void)Iteration;
@@ -236,16 +254,20 @@ SuspendCrossingInfo::SuspendCrossingInfo(Function &F, coro::Shape &Shape)
     LLVM_DEBUG(dbgs() << "==============\n");
 
     Changed = false;
-    for (size_t I = 0; I < N; ++I) {
+    for (size_t I : Order) {
       auto &B = Block[I];
       for (BasicBlock *SI : successors(B)) {
 
         auto SuccNo = Mapping.blockToIndex(SI);
 
-        // Saved Consumes and Kills bitsets so that it is easy to see
-        // if anything changed after propagation.
         auto &S = Block[SuccNo];
-        auto SavedConsumes = S.Consumes;
+
+        // Consumes only ever grows, so a change from propagating B into S can
+        // be detected up front without copying the bitset.
+        bool ConsumesChanged = B.Consumes.test(S.Consumes);
+
+        // Kills may shrink below (for coro.end and regular successors), so
+        // save it to see if anything changed after propagation.
         auto SavedKills = S.Kills;
 
         // Propagate Kills and Consumes from block B into its successor S.
@@ -274,7 +296,7 @@ SuspendCrossingInfo::SuspendCrossingInfo(Function &F, coro::Shape &Shape)
         }
 
         // See if anything changed.
-        Changed |= (S.Kills != SavedKills) || (S.Consumes != SavedConsumes);
+        Changed |= ConsumesChanged || (S.Kills != SavedKills);
 
         if (S.Kills != SavedKills) {
           LLVM_DEBUG(dbgs() << "\nblock " << I << " follower " << SI->getName()
@@ -282,10 +304,9 @@ SuspendCrossingInfo::SuspendCrossingInfo(Function &F, coro::Shape &Shape)
           LLVM_DEBUG(dump("S.Kills", S.Kills));
           LLVM_DEBUG(dump("SavedKills", SavedKills));
         }
-        if (S.Consumes != SavedConsumes) {
+        if (ConsumesChanged) {
           LLVM_DEBUG(dbgs() << "\nblock " << I << " follower " << SI << "\n");
           LLVM_DEBUG(dump("S.Consume", S.Consumes));
-          LLVM_DEBUG(dump("SavedCons", SavedConsumes));
         }
       }
     }
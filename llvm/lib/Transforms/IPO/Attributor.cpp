@@ -2255,9 +2255,13 @@ ChangeStatus Attributor::run() {
 }
 
 ChangeStatus Attributor::updateAA(AbstractAttribute &AA) {
-  TimeTraceScope TimeScope(
-      AA.getName() + std::to_string(AA.getIRPosition().getPositionKind()) +
-      "::updateAA");
+  // Only build the descriptive string if time tracing is on; this is the
+  // hottest function of the fixpoint iteration and the concatenation is not
+  // free.
+  TimeTraceScope TimeScope("updateAA", [&]() {
+    return AA.getName() +
+           std::to_string(AA.getIRPosition().getPositionKind());
+  });
   assert(Phase == AttributorPhase::UPDATE &&
          "We can update AA only in the update stage!");
 
@@ -40,6 +40,7 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
@@ -670,7 +671,16 @@ void llvm::ComputeCrossModuleImport(
   // they make as exported as well. We do this here, as it is more efficient
   // since we may import the same values multiple times into different modules
   // during the import computation.
-  for (auto &ELI : ExportLists) {
+  //
+  // Each export list only reads the (now immutable) index and its own module's
+  // defined summaries and mutates nothing shared, so the per-module closure
+  // can run in parallel.
+  SmallVector<StringMapEntry<FunctionImporter::ExportSetTy> *, 0> ExportEntries;
+  ExportEntries.reserve(ExportLists.size());
+  for (auto &ELI : ExportLists)
+    ExportEntries.push_back(&ELI);
+  parallelForEach(ExportEntries, [&](auto *ExportEntry) {
+    auto &ELI = *ExportEntry;
     FunctionImporter::ExportSetTy NewExports;
     const auto &DefinedGVSummaries =
         ModuleToDefinedGVSummaries.lookup(ELI.first());
@@ -714,7 +724,7 @@ void llvm::ComputeCrossModuleImport(
         ++EI;
     }
     ELI.second.insert(NewExports.begin(), NewExports.end());
-  }
+  });
 
   assert(checkVariableImport(Index, ImportLists, ExportLists));
 #ifndef NDEBUG
@@ -4211,6 +4211,14 @@ bool InstCombinerImpl::run() {
       if (!EnableCodeSinking)
         return None;
 
+      // Filter out instructions TryToSinkInstruction can never move before
+      // walking the user list below; the user walk with its PHI handling and
+      // dominator queries is the expensive part of this check, and most
+      // visited instructions have no legal sink destination anyway.
+      if (isa<PHINode>(I) || isa<AllocaInst>(I) || I->isEHPad() ||
+          I->isTerminator() || I->mayThrow() || !I->willReturn())
+        return None;
+
       BasicBlock *BB = I->getParent();
       BasicBlock *UserParent = nullptr;
       unsigned NumUsers = 0;
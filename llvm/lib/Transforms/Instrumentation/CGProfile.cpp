@@ -10,7 +10,6 @@
 
 #include "llvm/ADT/MapVector.h"
 #include "llvm/Analysis/BlockFrequencyInfo.h"
-#include "llvm/Analysis/LazyBlockFrequencyInfo.h"
 #include "llvm/Analysis/TargetTransformInfo.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/MDBuilder.h"
@@ -46,7 +45,7 @@ addModuleFlags(Module &M,
 
 static bool runCGProfilePass(
     Module &M, function_ref<BlockFrequencyInfo &(Function &)> GetBFI,
-    function_ref<TargetTransformInfo &(Function &)> GetTTI, bool LazyBFI) {
+    function_ref<TargetTransformInfo &(Function &)> GetTTI) {
   MapVector<std::pair<Function *, Function *>, uint64_t> Counts;
   InstrProfSymtab Symtab;
   auto UpdateCounts = [&](TargetTransformInfo &TTI, Function *F,
@@ -62,11 +61,11 @@ static bool runCGProfilePass(
   // Ignore error here.  Indirect calls are ignored if this fails.
   (void)(bool) Symtab.create(M);
   for (auto &F : M) {
-    // Avoid extra cost of running passes for BFI when the function doesn't have
-    // entry count. Since LazyBlockFrequencyInfoPass only exists in LPM, check
-    // if using LazyBlockFrequencyInfoPass.
-    // TODO: Remove LazyBFI when LazyBlockFrequencyInfoPass is available in NPM.
-    if (F.isDeclaration() || (LazyBFI && !F.getEntryCount()))
+    // Without an entry count getBlockProfileCount() returns None for every
+    // block, so the function cannot contribute any edge. Skip it before
+    // requesting BFI; computing block frequencies for every function is the
+    // dominant cost of this pass on non-PGO builds.
+    if (F.isDeclaration() || !F.getEntryCount())
       continue;
     auto &BFI = GetBFI(F);
     if (BFI.getEntryFreq() == 0)
@@ -111,7 +110,7 @@ PreservedAnalyses CGProfilePass::run(Module &M, ModuleAnalysisManager &MAM) {
     return FAM.getResult<TargetIRAnalysis>(F);
   };
 
-  runCGProfilePass(M, GetBFI, GetTTI, false);
+  runCGProfilePass(M, GetBFI, GetTTI);
 
   return PreservedAnalyses::all();
 }
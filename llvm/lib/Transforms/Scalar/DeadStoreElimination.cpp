@@ -1873,7 +1873,7 @@ struct DSEState {
 
   bool removePartiallyOverlappedStores(InstOverlapIntervalsTy &IOL) {
     bool Changed = false;
-    for (auto OI : IOL) {
+    for (auto &OI : IOL) {
       Instruction *DeadI = OI.first;
       MemoryLocation Loc = *getLocForWrite(DeadI);
       assert(isRemovable(DeadI) && "Expect only removable instruction");
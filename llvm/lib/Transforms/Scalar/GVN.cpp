@@ -2217,7 +2217,11 @@ void GVNPass::ValueTable::eraseTranslateCacheEntry(
 // question.  This is fast because dominator tree queries consist of only
 // a few comparisons of DFS numbers.
 Value *GVNPass::findLeader(const BasicBlock *BB, uint32_t num) {
-  LeaderTableEntry Vals = LeaderTable[num];
+  // Use lookup() rather than operator[] so that speculative queries for value
+  // numbers that have no leader do not grow the table. PRE in particular
+  // probes each predecessor for phi-translated value numbers, most of which
+  // have never been assigned a leader.
+  LeaderTableEntry Vals = LeaderTable.lookup(num);
   if (!Vals.Val) return nullptr;
 
   Value *Val = nullptr;
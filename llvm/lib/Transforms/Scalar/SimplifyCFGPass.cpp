@@ -285,7 +285,12 @@ static bool simplifyFunctionCFGImpl(Function &F, const TargetTransformInfo &TTI,
 
   do {
     EverChanged = iterativelySimplifyCFG(F, TTI, DT ? &DTU : nullptr, Options);
-    EverChanged |= removeUnreachableBlocks(F, DT ? &DTU : nullptr);
+    // If the simplification pass converged without changes, the CFG is exactly
+    // as the preceding removeUnreachableBlocks left it, so rescanning for
+    // unreachable blocks cannot find anything.
+    if (!EverChanged)
+      break;
+    EverChanged = removeUnreachableBlocks(F, DT ? &DTU : nullptr);
   } while (EverChanged);
 
   return true;
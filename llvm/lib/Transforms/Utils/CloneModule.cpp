@@ -113,10 +113,11 @@ std::unique_ptr<Module> llvm::CloneModule(
   // have been created, loop through and copy the global variable referrers
   // over...  We also set the attributes on the global now.
   //
+  SmallVector<std::pair<unsigned, MDNode *>, 8> MDs;
   for (const GlobalVariable &G : M.globals()) {
     GlobalVariable *GV = cast<GlobalVariable>(VMap[&G]);
 
-    SmallVector<std::pair<unsigned, MDNode *>, 1> MDs;
+    MDs.clear();
     G.getAllMetadata(MDs);
     for (auto MD : MDs)
       GV->addMetadata(MD.first, *MapMetadata(MD.second, VMap));
@@ -143,7 +144,7 @@ std::unique_ptr<Module> llvm::CloneModule(
     if (I.isDeclaration()) {
       // Copy over metadata for declarations since we're not doing it below in
       // CloneFunctionInto().
-      SmallVector<std::pair<unsigned, MDNode *>, 1> MDs;
+      MDs.clear();
       I.getAllMetadata(MDs);
       for (auto MD : MDs)
         F->addMetadata(MD.first, *MapMetadata(MD.second, VMap));
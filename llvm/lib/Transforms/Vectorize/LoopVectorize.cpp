@@ -1166,11 +1166,14 @@ public:
                                     const LoopVectorizationPlanner &LVP);
 
   /// Setup cost-based decisions for user vectorization factor.
-  /// \return true if the UserVF is a feasible VF to be chosen.
-  bool selectUserVectorizationFactor(ElementCount UserVF) {
+  /// \return the cost of the loop with \p UserVF if it is a feasible VF to
+  /// be chosen, and an invalid cost otherwise. Returning the cost lets the
+  /// caller reuse it for the interleave count selection instead of running
+  /// the whole cost model over the loop a second time for the same VF.
+  InstructionCost selectUserVectorizationFactor(ElementCount UserVF) {
     collectUniformsAndScalars(UserVF);
     collectInstsToScalarize(UserVF);
-    return expectedCost(UserVF).first.isValid();
+    return expectedCost(UserVF).first;
   }
 
   /// \return The size (in bits) of the smallest and widest types in the code
@@ -5663,8 +5666,9 @@ unsigned LoopVectorizationCostModel::selectInterleaveCount(ElementCount VF,
       !(InterleaveSmallLoopScalarReduction && HasReductions && VF.isScalar()))
     return 1;
 
-  // If we did not calculate the cost for VF (because the user selected the VF)
-  // then we calculate the cost of VF here.
+  // If we did not calculate the cost for VF (because vectorization was
+  // disabled and we are only interleaving) then we calculate the cost of VF
+  // here.
   if (LoopCost == 0) {
     InstructionCost C = expectedCost(VF).first;
     assert(C.isValid() && "Expected to have chosen a VF with valid cost");
@@ -7413,7 +7417,9 @@ static unsigned determineVPlanVF(const unsigned WidestVectorRegBits,
                                  LoopVectorizationCostModel &CM) {
   unsigned WidestType;
   std::tie(std::ignore, WidestType) = CM.getSmallestAndWidestTypes();
-  return WidestVectorRegBits / WidestType;
+  // Only power-of-two factors are supported downstream; round down rather
+  // than tripping the power-of-two assertion for odd register widths.
+  return PowerOf2Floor(WidestVectorRegBits / WidestType);
 }
 
 VectorizationFactor
@@ -7440,6 +7446,15 @@ LoopVectorizationPlanner::planInVPlanNativePath(ElementCount UserVF) {
                           << "overriding computed VF.\n");
         VF = ElementCount::getFixed(4);
       }
+
+      // Bail out if the target has no vector registers wide enough for the
+      // loop's widest type: executing a VF=1 plan would restructure the loop
+      // without producing any vector code.
+      if (VF.isZero() || VF.isScalar()) {
+        LLVM_DEBUG(dbgs() << "LV: Not vectorizing. No profitable VF for the "
+                             "outer loop.\n");
+        return VectorizationFactor::Disabled();
+      }
     }
     assert(EnableVPlanNativePath && "VPlan-native path is not enabled.");
     assert(isPowerOf2_32(VF.getKnownMinValue()) &&
@@ -7488,14 +7503,21 @@ LoopVectorizationPlanner::plan(ElementCount UserVF, unsigned UserIC) {
   if (!UserVF.isZero() && UserVFIsLegal) {
     assert(isPowerOf2_32(UserVF.getKnownMinValue()) &&
            "VF needs to be a power of two");
+    // Collect in-loop reductions before costing the user VF so that the cost
+    // reflects the reduction strategy that will actually be used.
+    CM.collectInLoopReductions();
     // Collect the instructions (and their associated costs) that will be more
     // profitable to scalarize.
-    if (CM.selectUserVectorizationFactor(UserVF)) {
+    InstructionCost UserVFCost = CM.selectUserVectorizationFactor(UserVF);
+    if (UserVFCost.isValid()) {
       LLVM_DEBUG(dbgs() << "LV: Using user VF " << UserVF << ".\n");
-      CM.collectInLoopReductions();
       buildVPlansWithVPRecipes(UserVF, UserVF);
       LLVM_DEBUG(printPlans(dbgs()));
-      return {{UserVF, 0, 0}};
+      // Keep the computed loop cost so that selecting the interleave count
+      // does not have to re-run the cost model for the same VF. The scalar
+      // cost is deliberately left at zero: downstream profitability checks
+      // treat a zero scalar cost as a user-forced VF.
+      return {{UserVF, UserVFCost, 0}};
     } else
       reportVectorizationInfo("UserVF ignored because of invalid costs.",
                               "InvalidCost", ORE, OrigLoop);
@@ -53,6 +53,11 @@ Error loadNaiveFormatLog(StringRef Data, bool IsLittleEndian,
     return FileHeaderOrError.takeError();
   FileHeader = std::move(FileHeaderOrError.get());
 
+  // The fixed record size lets us size the vector for the whole trace up
+  // front, which matters for large traces: every reallocation has to move
+  // records that own heap-allocated call argument vectors.
+  Records.reserve((Data.size() - 32) / 32);
+
   // Each record after the header will be 32 bytes, in the following format:
   //
   //   (2)   uint16 : record type
@@ -367,6 +372,7 @@ Error loadYAMLLog(StringRef Data, XRayFileHeader &FileHeader,
         std::make_error_code(std::errc::invalid_argument));
 
   Records.clear();
+  Records.reserve(Trace.Records.size());
   std::transform(Trace.Records.begin(), Trace.Records.end(),
                  std::back_inserter(Records), [&](const YAMLXRayRecord &R) {
                    return XRayRecord{R.RecordType, R.CPU,      R.Type,
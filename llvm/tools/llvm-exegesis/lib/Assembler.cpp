@@ -172,15 +172,13 @@ BitVector getFunctionReservedRegs(const TargetMachine &TM) {
   return MF.getSubtarget().getRegisterInfo()->getReservedRegs(MF);
 }
 
-Error assembleToStream(const ExegesisTarget &ET,
-                       std::unique_ptr<LLVMTargetMachine> TM,
+Error assembleToStream(const ExegesisTarget &ET, LLVMTargetMachine &TM,
                        ArrayRef<unsigned> LiveIns,
                        ArrayRef<RegisterValue> RegisterInitialValues,
                        const FillFunction &Fill, raw_pwrite_stream &AsmStream) {
   auto Context = std::make_unique<LLVMContext>();
-  std::unique_ptr<Module> Module =
-      createModule(Context, TM->createDataLayout());
-  auto MMIWP = std::make_unique<MachineModuleInfoWrapperPass>(TM.get());
+  std::unique_ptr<Module> Module = createModule(Context, TM.createDataLayout());
+  auto MMIWP = std::make_unique<MachineModuleInfoWrapperPass>(&TM);
   MachineFunction &MF = createVoidVoidPtrMachineFunction(
       FunctionID, Module.get(), &MMIWP.get()->getMMI());
   MF.ensureAlignment(kFunctionAlignment);
@@ -205,7 +203,7 @@ Error assembleToStream(const ExegesisTarget &ET,
     Entry.MBB->addLiveIn(Reg);
 
   const bool IsSnippetSetupComplete = generateSnippetSetupCode(
-      ET, TM->getMCSubtargetInfo(), RegisterInitialValues, Entry);
+      ET, TM.getMCSubtargetInfo(), RegisterInitialValues, Entry);
 
   // If the snippet setup is not complete, we disable liveliness tracking. This
   // means that we won't know what values are in the registers.
@@ -225,7 +223,7 @@ Error assembleToStream(const ExegesisTarget &ET,
   TargetLibraryInfoImpl TLII(Triple(Module->getTargetTriple()));
   PM.add(new TargetLibraryInfoWrapperPass(TLII));
 
-  TargetPassConfig *TPC = TM->createPassConfig(PM);
+  TargetPassConfig *TPC = TM.createPassConfig(PM);
   PM.add(TPC);
   PM.add(MMIWP.release());
   TPC->printAndVerify("MachineFunctionGenerator::assemble");
@@ -243,7 +241,7 @@ Error assembleToStream(const ExegesisTarget &ET,
   TPC->setInitialized();
 
   // AsmPrinter is responsible for generating the assembly into AsmBuffer.
-  if (TM->addAsmPrinter(PM, AsmStream, nullptr, CGFT_ObjectFile, MCContext))
+  if (TM.addAsmPrinter(PM, AsmStream, nullptr, CGFT_ObjectFile, MCContext))
     return make_error<Failure>("Cannot add AsmPrinter passes");
 
   PM.run(*Module); // Run all the passes
@@ -86,9 +86,9 @@ using FillFunction = std::function<void(FunctionFiller &)>;
 // Creates a temporary `void foo(char*)` function containing the provided
 // Instructions. Runs a set of llvm Passes to provide correct prologue and
 // epilogue. Once the MachineFunction is ready, it is assembled for TM to
-// AsmStream, the temporary function is eventually discarded.
-Error assembleToStream(const ExegesisTarget &ET,
-                       std::unique_ptr<LLVMTargetMachine> TM,
+// AsmStream, the temporary function is eventually discarded. TM is only
+// borrowed, so a single TargetMachine can serve many calls.
+Error assembleToStream(const ExegesisTarget &ET, LLVMTargetMachine &TM,
                        ArrayRef<unsigned> LiveIns,
                        ArrayRef<RegisterValue> RegisterInitialValues,
                        const FillFunction &Fill, raw_pwrite_stream &AsmStream);
@@ -164,6 +164,12 @@ Expected<InstructionBenchmark> BenchmarkRunner::runConfiguration(
   };
   ClearBenchmarkOnReturn CBOR(&InstrBenchmark);
 
+  // Assembling only borrows the target machine, so create a single one up
+  // front and reuse it for every repetitor instead of re-initializing the
+  // target machinery per snippet.
+  const std::unique_ptr<LLVMTargetMachine> AssemblingTM =
+      State.createTargetMachine();
+
   for (const std::unique_ptr<const SnippetRepetitor> &Repetitor : Repetitors) {
     // Assemble at least kMinInstructionsForSnippet instructions by repeating
     // the snippet for debug/analysis. This is so that the user clearly
@@ -174,8 +180,8 @@ Expected<InstructionBenchmark> BenchmarkRunner::runConfiguration(
       SmallString<0> Buffer;
       raw_svector_ostream OS(Buffer);
       if (Error E = assembleToStream(
-              State.getExegesisTarget(), State.createTargetMachine(),
-              BC.LiveIns, BC.Key.RegisterInitialValues,
+              State.getExegesisTarget(), *AssemblingTM, BC.LiveIns,
+              BC.Key.RegisterInitialValues,
               Repetitor->Repeat(Instructions, MinInstructionsForSnippet,
                                 LoopBodySizeForSnippet),
               OS)) {
@@ -205,9 +211,9 @@ Expected<InstructionBenchmark> BenchmarkRunner::runConfiguration(
     } else {
       SmallString<0> Buffer;
       raw_svector_ostream OS(Buffer);
-      if (Error E = assembleToStream(
-              State.getExegesisTarget(), State.createTargetMachine(),
-              BC.LiveIns, BC.Key.RegisterInitialValues, Filler, OS)) {
+      if (Error E = assembleToStream(State.getExegesisTarget(), *AssemblingTM,
+                                     BC.LiveIns, BC.Key.RegisterInitialValues,
+                                     Filler, OS)) {
         return std::move(E);
       }
       ObjectFile = getObjectFromBuffer(OS.str());
@@ -267,9 +273,10 @@ BenchmarkRunner::writeObjectFile(const BenchmarkCode &BC,
           sys::fs::createTemporaryFile("snippet", "o", ResultFD, ResultPath)))
     return std::move(E);
   raw_fd_ostream OFS(ResultFD, true /*ShouldClose*/);
-  if (Error E = assembleToStream(
-          State.getExegesisTarget(), State.createTargetMachine(), BC.LiveIns,
-          BC.Key.RegisterInitialValues, FillFunction, OFS)) {
+  const std::unique_ptr<LLVMTargetMachine> TM = State.createTargetMachine();
+  if (Error E =
+          assembleToStream(State.getExegesisTarget(), *TM, BC.LiveIns,
+                           BC.Key.RegisterInitialValues, FillFunction, OFS)) {
     return std::move(E);
   }
   return std::string(ResultPath.str());
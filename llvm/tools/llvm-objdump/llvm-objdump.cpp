@@ -1478,7 +1478,9 @@ static void disassembleObject(const Target *TheTarget, ObjectFile &Obj,
     uint64_t Size;
     uint64_t Index;
     bool PrintedSection = false;
-    std::vector<RelocationRef> Rels = RelocMap[Section];
+    // Take the relocations by reference; copying them costs a fresh vector of
+    // every relocation in the section for each section dumped.
+    std::vector<RelocationRef> &Rels = RelocMap[Section];
     std::vector<RelocationRef>::const_iterator RelCur = Rels.begin();
     std::vector<RelocationRef>::const_iterator RelEnd = Rels.end();
     // Disassemble symbol by symbol.
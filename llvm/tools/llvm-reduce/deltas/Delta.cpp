@@ -291,20 +291,22 @@ void llvm::runDeltaPass(TestRunner &Test,
     ChunkThreadPoolPtr =
         std::make_unique<ThreadPool>(hardware_concurrency(NumJobs));
 
+  // When running with more than one thread, serialize the original bitcode
+  // to OriginalBC once up front: the program is only replaced after this pass
+  // completes, so the same serialization serves every granularity round, and
+  // reduction state is carried by the uninteresting-chunk sets instead.
+  SmallString<0> OriginalBC;
+  if (NumJobs > 1) {
+    raw_svector_ostream BCOS(OriginalBC);
+    writeBitcode(Test.getProgram(), BCOS);
+  }
+
   bool FoundAtLeastOneNewUninterestingChunkWithCurrentGranularity;
   do {
     FoundAtLeastOneNewUninterestingChunkWithCurrentGranularity = false;
 
     std::set<Chunk> UninterestingChunks;
 
-    // When running with more than one thread, serialize the original bitcode
-    // to OriginalBC.
-    SmallString<0> OriginalBC;
-    if (NumJobs > 1) {
-      raw_svector_ostream BCOS(OriginalBC);
-      writeBitcode(Test.getProgram(), BCOS);
-    }
-
     std::deque<std::shared_future<SmallString<0>>> TaskQueue;
     for (auto I = ChunksStillConsideredInteresting.rbegin(),
               E = ChunksStillConsideredInteresting.rend();
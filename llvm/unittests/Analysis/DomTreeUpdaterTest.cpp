@@ -792,3 +792,54 @@ TEST(DomTreeUpdater, LazyUpdateDeduplicationTest) {
   DTU.applyUpdates({{DominatorTree::Insert, BB0, BB2}});
   ASSERT_TRUE(DTU.getDomTree().verify());
 }
+
+TEST(DomTreeUpdater, LazyUpdateInversePairCancellationTest) {
+  StringRef FuncName = "f";
+  StringRef ModuleString = R"(
+                           define i32 @f() {
+                           bb0:
+                              br label %bb1
+                           bb1:
+                              ret i32 1
+                           bb2:
+                              ret i32 1
+                           }
+                           )";
+  // Make the module.
+  LLVMContext Context;
+  std::unique_ptr<Module> M = makeLLVMModule(Context, ModuleString);
+  Function *F = M->getFunction(FuncName);
+
+  // Make the DTU.
+  DominatorTree DT(*F);
+  DomTreeUpdater DTU(&DT, nullptr, DomTreeUpdater::UpdateStrategy::Lazy);
+  ASSERT_TRUE(DTU.getDomTree().verify());
+
+  Function::iterator FI = F->begin();
+  BasicBlock *BB0 = &*FI++;
+  BasicBlock *BB1 = &*FI++;
+  BasicBlock *BB2 = &*FI++;
+
+  // CFG Change: add bb0 -> bb2 and remove it again. The CFG ends up
+  // unchanged.
+  EXPECT_EQ(BB0->getTerminator()->getNumSuccessors(), 1u);
+  BB0->getTerminator()->eraseFromParent();
+  BranchInst::Create(BB1, BB2, ConstantInt::getTrue(F->getContext()), BB0);
+  BB0->getTerminator()->eraseFromParent();
+  BranchInst::Create(BB1, BB0);
+  EXPECT_EQ(BB0->getTerminator()->getNumSuccessors(), 1u);
+
+  // An update queued right after its exact inverse cancels out instead of
+  // accumulating in the pending queue.
+  DTU.applyUpdates({{DominatorTree::Insert, BB0, BB2}});
+  ASSERT_TRUE(DTU.hasPendingUpdates());
+  DTU.applyUpdates({{DominatorTree::Delete, BB0, BB2}});
+  ASSERT_FALSE(DTU.hasPendingUpdates());
+  ASSERT_TRUE(DTU.getDomTree().verify());
+
+  // Both updates in a single batch cancel out as well.
+  DTU.applyUpdates({{DominatorTree::Insert, BB0, BB2},
+                    {DominatorTree::Delete, BB0, BB2}});
+  ASSERT_FALSE(DTU.hasPendingUpdates());
+  ASSERT_TRUE(DTU.getDomTree().verify());
+}
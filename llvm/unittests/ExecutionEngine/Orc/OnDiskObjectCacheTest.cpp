@@ -0,0 +1,90 @@
+//===-------- OnDiskObjectCacheTest.cpp - Unit tests for OnDiskObjectCache ===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/Orc/OnDiskObjectCache.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+namespace {
+
+class OnDiskObjectCacheTest : public testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_FALSE(
+        sys::fs::createUniqueDirectory("on-disk-object-cache", CacheDir));
+  }
+
+  void TearDown() override { sys::fs::remove_directories(CacheDir); }
+
+  std::unique_ptr<Module> makeModule(StringRef FnName) {
+    auto M = std::make_unique<Module>("m", Ctx);
+    Function::Create(FunctionType::get(Type::getVoidTy(Ctx), false),
+                     GlobalValue::ExternalLinkage, FnName, M.get());
+    return M;
+  }
+
+  LLVMContext Ctx;
+  SmallString<128> CacheDir;
+};
+
+TEST_F(OnDiskObjectCacheTest, MissThenHit) {
+  auto M = makeModule("foo");
+
+  auto Cache = cantFail(OnDiskObjectCache::Create(CacheDir));
+  EXPECT_EQ(Cache->getObject(M.get()), nullptr);
+
+  StringRef FakeObject = "not really an object file";
+  Cache->notifyObjectCompiled(
+      M.get(), MemoryBufferRef(FakeObject, "test-object"));
+
+  auto Cached = Cache->getObject(M.get());
+  ASSERT_NE(Cached, nullptr);
+  EXPECT_EQ(Cached->getBuffer(), FakeObject);
+}
+
+TEST_F(OnDiskObjectCacheTest, HitAcrossInstances) {
+  // Keys are content-addressed, so a byte-identical module compiled by a
+  // different cache instance (i.e. a different process) must hit.
+  auto M = makeModule("foo");
+
+  {
+    auto Cache = cantFail(OnDiskObjectCache::Create(CacheDir));
+    ASSERT_EQ(Cache->getObject(M.get()), nullptr);
+    Cache->notifyObjectCompiled(M.get(),
+                                MemoryBufferRef("some object", "test-object"));
+  }
+
+  auto Cache = cantFail(OnDiskObjectCache::Create(CacheDir));
+  auto Cached = Cache->getObject(M.get());
+  ASSERT_NE(Cached, nullptr);
+  EXPECT_EQ(Cached->getBuffer(), "some object");
+}
+
+TEST_F(OnDiskObjectCacheTest, DistinctModulesAndSaltsDoNotCollide) {
+  auto MA = makeModule("foo");
+  auto MB = makeModule("bar");
+
+  auto Cache = cantFail(OnDiskObjectCache::Create(CacheDir));
+  Cache->notifyObjectCompiled(MA.get(),
+                              MemoryBufferRef("object A", "test-object"));
+  EXPECT_EQ(Cache->getObject(MB.get()), nullptr);
+
+  // A different salt must not see objects cached under the default salt.
+  auto SaltedCache =
+      cantFail(OnDiskObjectCache::Create(CacheDir, "cpu=other"));
+  EXPECT_EQ(SaltedCache->getObject(MA.get()), nullptr);
+}
+
+} // namespace
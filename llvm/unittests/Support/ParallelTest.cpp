@@ -92,4 +92,16 @@ TEST(Parallel, ForEachError) {
   EXPECT_EQ(errText, std::string("asdf\nasdf\nasdf"));
 }
 
+TEST(Parallel, NestedParallelFor) {
+  // Nested parallel regions must neither deadlock the pool nor drop work;
+  // the waiting threads are expected to help drain the queue.
+  uint32_t range[256][64] = {};
+  parallelFor(0, 256, [&range](size_t I) {
+    parallelFor(0, 64, [&range, I](size_t J) { ++range[I][J]; });
+  });
+  for (auto &row : range)
+    for (uint32_t v : row)
+      ASSERT_EQ(v, 1u);
+}
+
 #endif
@@ -234,6 +234,20 @@ TEST_F(SpecialCaseListTest, PopularTrigram) {
   EXPECT_TRUE(SCL->inSection("", "fun", "aaaabbbaaa"));
 }
 
+TEST_F(SpecialCaseListTest, PrefixRules) {
+  std::unique_ptr<SpecialCaseList> SCL =
+      makeSpecialCaseList("src:include/*\n"
+                          "src:include-private/a*\n"
+                          "fun:*\n");
+  EXPECT_TRUE(SCL->inSection("", "src", "include/utility"));
+  EXPECT_TRUE(SCL->inSection("", "src", "include-private/abc"));
+  EXPECT_FALSE(SCL->inSection("", "src", "include-private/bcd"));
+  EXPECT_FALSE(SCL->inSection("", "src", "incl"));
+  EXPECT_TRUE(SCL->inSection("", "fun", "anything"));
+  EXPECT_EQ(1u, SCL->inSectionBlame("", "src", "include/utility"));
+  EXPECT_EQ(2u, SCL->inSectionBlame("", "src", "include-private/abc"));
+}
+
 TEST_F(SpecialCaseListTest, EscapedSymbols) {
   std::unique_ptr<SpecialCaseList> SCL = makeSpecialCaseList("src:*c\\+\\+abi*\n"
                                                              "src:*hello\\\\world*\n");
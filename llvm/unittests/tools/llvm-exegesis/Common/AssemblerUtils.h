@@ -77,7 +77,8 @@ private:
                      FillFunction Fill) {
     SmallString<256> Buffer;
     raw_svector_ostream AsmStream(Buffer);
-    EXPECT_FALSE(assembleToStream(*ET, createTargetMachine(), /*LiveIns=*/{},
+    std::unique_ptr<LLVMTargetMachine> TM = createTargetMachine();
+    EXPECT_FALSE(assembleToStream(*ET, *TM, /*LiveIns=*/{},
                                   RegisterInitialValues, Fill, AsmStream));
     return ExecutableFunction(createTargetMachine(),
                               getObjectFromBuffer(AsmStream.str()));
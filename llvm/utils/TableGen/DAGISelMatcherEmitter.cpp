@@ -571,8 +571,13 @@ EmitMatcher(const Matcher *N, const unsigned Indent, unsigned CurrentIdx,
 
  case Matcher::CheckType:
     if (cast<CheckTypeMatcher>(N)->getResNo() == 0) {
-      OS << "OPC_CheckType, "
-         << getEnumName(cast<CheckTypeMatcher>(N)->getType()) << ",\n";
+      MVT::SimpleValueType VT = cast<CheckTypeMatcher>(N)->getType();
+      // Use the space-optimized forms for the common scalar integer types.
+      if (VT == MVT::i32 || VT == MVT::i64) {
+        OS << "OPC_CheckTypeI" << (VT == MVT::i32 ? "32" : "64") << ",\n";
+        return 1;
+      }
+      OS << "OPC_CheckType, " << getEnumName(VT) << ",\n";
       return 2;
     }
     OS << "OPC_CheckTypeRes, " << cast<CheckTypeMatcher>(N)->getResNo()
@@ -223,8 +223,13 @@ public:
   /// Each item is processed by invoking the child analysis at the program
   /// point.
   using WorkItem = std::pair<ProgramPoint, DataFlowAnalysis *>;
-  /// Push a work item onto the worklist.
-  void enqueue(WorkItem item) { worklist.push(std::move(item)); }
+  /// Push a work item onto the worklist. Items already pending are not pushed
+  /// again: their eventual visit observes the lattice as of that time, so a
+  /// second visit for an update that arrived while still queued is redundant.
+  void enqueue(WorkItem item) {
+    if (pendingWorkItems.insert(item).second)
+      worklist.push(std::move(item));
+  }
 
   /// Get the state associated with the given program point. If it does not
   /// exist, create an uninitialized state.
@@ -247,6 +252,11 @@ private:
   /// quickly degenerate to quadratic due to propagation of state updates.
   std::queue<WorkItem> worklist;
 
+  /// The set of work items currently sitting on the queue, used to drop
+  /// duplicate enqueues. An item is removed when it is popped for processing,
+  /// so updates arriving during its visit re-enqueue it.
+  DenseSet<WorkItem> pendingWorkItems;
+
   /// Type-erased instances of the children analyses.
   SmallVector<std::unique_ptr<DataFlowAnalysis>> childAnalyses;
 
@@ -80,6 +80,14 @@ struct ExecutionEngineOptions {
   /// be dumped to a file via the `dumpToObjectfile` method.
   bool enableObjectCache = false;
 
+  /// If `objectCache` is provided, it is consulted before JIT-compilation and
+  /// notified of newly compiled objects, instead of the engine-private cache
+  /// controlled by `enableObjectCache`. The cache is not owned by the engine
+  /// and may be shared by several engines, so that object code for recurring
+  /// modules is compiled once, and may outlive any engine if the caller
+  /// persists its entries.
+  llvm::ObjectCache *objectCache = nullptr;
+
   /// If enable `enableGDBNotificationListener` is set, the JIT compiler will
   /// notify the llvm's global GDB notification listener.
   bool enableGDBNotificationListener = true;
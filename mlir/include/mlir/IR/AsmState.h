@@ -225,6 +225,21 @@ public:
   }
 };
 
+/// This class provides a simple utility wrapper for creating AsmResourceBlobs
+/// backed by a file on disk. Large files are memory mapped rather than read,
+/// so the blob references the file contents in place and multi-gigabyte
+/// resources (e.g. tensor constant data) are never copied into the process
+/// heap. The mapping is released when the blob is destroyed.
+class FileAsmResourceBlob {
+public:
+  /// Create a blob containing the contents of the file at the given path,
+  /// which must satisfy the given alignment requirement. On failure,
+  /// `errorMessage` is populated with the reason when non-null, and a blob
+  /// with null data is returned.
+  static AsmResourceBlob mapFile(StringRef path, size_t dataAlignment,
+                                 std::string *errorMessage = nullptr);
+};
+
 /// This class is used to build resource entries for use by the printer. Each
 /// resource entry is represented using a key/value pair. The provided key must
 /// be unique within the current context, which allows for a client to provide
@@ -394,13 +409,22 @@ private:
 /// contains all of the necessary state to parse a MLIR source file.
 class ParserConfig {
 public:
-  ParserConfig(MLIRContext *context) : context(context) {
+  /// Construct a parser configuration with the given context.
+  /// `verifyAfterParse` indicates if the parser should verify the IR after
+  /// parsing. Verification can be safely skipped for inputs that are known to
+  /// be valid, e.g. bytecode produced by the same deployment, where it is a
+  /// significant portion of load time for large modules.
+  ParserConfig(MLIRContext *context, bool verifyAfterParse = true)
+      : context(context), verifyAfterParse(verifyAfterParse) {
     assert(context && "expected valid MLIR context");
   }
 
   /// Return the MLIRContext to be used when parsing.
   MLIRContext *getContext() const { return context; }
 
+  /// Returns if the parser should verify the IR after parsing.
+  bool shouldVerifyAfterParse() const { return verifyAfterParse; }
+
   /// Return the resource parser registered to the given name, or nullptr if no
   /// parser with `name` is registered.
   AsmResourceParser *getResourceParser(StringRef name) const {
@@ -428,6 +452,7 @@ public:
 
 private:
   MLIRContext *context;
+  bool verifyAfterParse;
   DenseMap<StringRef, std::unique_ptr<AsmResourceParser>> resourceParsers;
 };
 
@@ -75,8 +75,10 @@ LogicalResult DataFlowSolver::initializeAndRun(Operation *top) {
   do {
     // Exhaust the worklist.
     while (!worklist.empty()) {
-      auto [point, analysis] = worklist.front();
+      WorkItem item = worklist.front();
       worklist.pop();
+      pendingWorkItems.erase(item);
+      auto [point, analysis] = item;
 
       DATAFLOW_DEBUG(llvm::dbgs() << "Invoking '" << analysis->debugName
                                   << "' on: " << point << "\n");
@@ -27,6 +27,11 @@ static bool isPunct(char c) {
   return c == '$' || c == '.' || c == '_' || c == '-';
 }
 
+// The predicates below run once per character of the buffer, so use the
+// inline, locale-independent classifiers from StringExtras instead of the
+// libc ones (which are out-of-line calls and undefined for negative chars).
+
+
 Lexer::Lexer(const llvm::SourceMgr &sourceMgr, MLIRContext *context,
              AsmParserCodeCompleteContext *codeCompleteContext)
     : sourceMgr(sourceMgr), context(context), codeCompleteLoc(nullptr) {
@@ -76,7 +81,7 @@ Token Lexer::lexToken() {
     switch (*curPtr++) {
     default:
       // Handle bare identifiers.
-      if (isalpha(curPtr[-1]))
+      if (llvm::isAlpha(curPtr[-1]))
         return lexBareIdentifierOrKeyword(tokStart);
 
       // Unknown character, emit an error.
@@ -200,12 +205,12 @@ Token Lexer::lexAtIdentifier(const char *tokStart) {
   }
 
   // Otherwise, these always start with a letter or underscore.
-  if (!isalpha(cur) && cur != '_')
+  if (!llvm::isAlpha(cur) && cur != '_')
     return emitError(curPtr - 1,
                      "@ identifier expected to start with letter or '_'");
 
-  while (isalpha(*curPtr) || isdigit(*curPtr) || *curPtr == '_' ||
-         *curPtr == '$' || *curPtr == '.')
+  while (llvm::isAlnum(*curPtr) || *curPtr == '_' || *curPtr == '$' ||
+         *curPtr == '.')
     ++curPtr;
   return formToken(Token::at_identifier, tokStart);
 }
@@ -217,8 +222,8 @@ Token Lexer::lexAtIdentifier(const char *tokStart) {
 ///
 Token Lexer::lexBareIdentifierOrKeyword(const char *tokStart) {
   // Match the rest of the identifier regex: [0-9a-zA-Z_.$]*
-  while (isalpha(*curPtr) || isdigit(*curPtr) || *curPtr == '_' ||
-         *curPtr == '$' || *curPtr == '.')
+  while (llvm::isAlnum(*curPtr) || *curPtr == '_' || *curPtr == '$' ||
+         *curPtr == '.')
     ++curPtr;
 
   // Check to see if this identifier is a keyword.
@@ -293,24 +298,24 @@ Token Lexer::lexEllipsis(const char *tokStart) {
 ///   float-literal ::= [-+]?[0-9]+[.][0-9]*([eE][-+]?[0-9]+)?
 ///
 Token Lexer::lexNumber(const char *tokStart) {
-  assert(isdigit(curPtr[-1]));
+  assert(llvm::isDigit(curPtr[-1]));
 
   // Handle the hexadecimal case.
   if (curPtr[-1] == '0' && *curPtr == 'x') {
     // If we see stuff like 0xi32, this is a literal `0` followed by an
     // identifier `xi32`, stop after `0`.
-    if (!isxdigit(curPtr[1]))
+    if (!llvm::isHexDigit(curPtr[1]))
       return formToken(Token::integer, tokStart);
 
     curPtr += 2;
-    while (isxdigit(*curPtr))
+    while (llvm::isHexDigit(*curPtr))
       ++curPtr;
 
     return formToken(Token::integer, tokStart);
   }
 
   // Handle the normal decimal case.
-  while (isdigit(*curPtr))
+  while (llvm::isDigit(*curPtr))
     ++curPtr;
 
   if (*curPtr != '.')
@@ -318,15 +323,14 @@ Token Lexer::lexNumber(const char *tokStart) {
   ++curPtr;
 
   // Skip over [0-9]*([eE][-+]?[0-9]+)?
-  while (isdigit(*curPtr))
+  while (llvm::isDigit(*curPtr))
     ++curPtr;
 
   if (*curPtr == 'e' || *curPtr == 'E') {
-    if (isdigit(static_cast<unsigned char>(curPtr[1])) ||
-        ((curPtr[1] == '-' || curPtr[1] == '+') &&
-         isdigit(static_cast<unsigned char>(curPtr[2])))) {
+    if (llvm::isDigit(curPtr[1]) ||
+        ((curPtr[1] == '-' || curPtr[1] == '+') && llvm::isDigit(curPtr[2]))) {
       curPtr += 2;
-      while (isdigit(*curPtr))
+      while (llvm::isDigit(*curPtr))
         ++curPtr;
     }
   }
@@ -367,14 +371,14 @@ Token Lexer::lexPrefixedIdentifier(const char *tokStart) {
   }
 
   // Parse suffix-id.
-  if (isdigit(*curPtr)) {
+  if (llvm::isDigit(*curPtr)) {
     // If suffix-id starts with a digit, the rest must be digits.
-    while (isdigit(*curPtr))
+    while (llvm::isDigit(*curPtr))
       ++curPtr;
-  } else if (isalpha(*curPtr) || isPunct(*curPtr)) {
+  } else if (llvm::isAlpha(*curPtr) || isPunct(*curPtr)) {
     do {
       ++curPtr;
-    } while (isalpha(*curPtr) || isdigit(*curPtr) || isPunct(*curPtr));
+    } while (llvm::isAlnum(*curPtr) || isPunct(*curPtr));
   } else if (curPtr == codeCompleteLoc) {
     return formToken(Token::code_complete, tokStart);
   } else {
@@ -173,12 +173,7 @@ void BufferizationAliasInfo::applyOnAliases(
 
 BufferizationAliasInfo::EquivalenceClassRangeType
 BufferizationAliasInfo::getAliases(Value v) const {
-  DenseSet<Value> res;
   auto it = aliasInfo.findValue(aliasInfo.getLeaderValue(v));
-  for (auto mit = aliasInfo.member_begin(it), meit = aliasInfo.member_end();
-       mit != meit; ++mit) {
-    res.insert(static_cast<Value>(*mit));
-  }
   return BufferizationAliasInfo::EquivalenceClassRangeType(
       aliasInfo.member_begin(it), aliasInfo.member_end());
 }
@@ -434,6 +429,11 @@ static bool hasReadAfterWriteInterference(
   Optional<Region *> repetitiveRegionOfWrites =
       getCommonEnclosingRepetitiveRegion(writtenAliases);
 
+  // findLastPrecedingWrite traverses the reverse SSA use-def chain, and
+  // several reads in the alias set frequently share the same operand value,
+  // so memoize the result per value for the duration of this query.
+  DenseMap<Value, SetVector<Value>> lastWritesCache;
+
   for (OpOperand *uRead : usesRead) {
     Operation *readingOp = uRead->getOwner();
 
@@ -447,7 +447,13 @@ static bool hasReadAfterWriteInterference(
     // In the above example, if uRead is the OpOperand of reading_op, lastWrite
     // is %0. Note that operations that create an alias but do not write (such
     // as ExtractSliceOp) are skipped.
-    SetVector<Value> lastWrites = state.findLastPrecedingWrite(uRead->get());
+    auto lastWritesIt = lastWritesCache.find(uRead->get());
+    if (lastWritesIt == lastWritesCache.end())
+      lastWritesIt = lastWritesCache
+                         .try_emplace(uRead->get(),
+                                      state.findLastPrecedingWrite(uRead->get()))
+                         .first;
+    const SetVector<Value> &lastWrites = lastWritesIt->second;
 
     // Look for conflicting memory writes. Potential conflicts are writes to an
     // alias that have been decided to bufferize inplace.
@@ -256,9 +256,6 @@ extern "C" AsyncGroup *mlirAsyncRuntimeCreateGroup(int64_t size) {
 
 extern "C" int64_t mlirAsyncRuntimeAddTokenToGroup(AsyncToken *token,
                                                    AsyncGroup *group) {
-  std::unique_lock<std::mutex> lockToken(token->mu);
-  std::unique_lock<std::mutex> lockGroup(group->mu);
-
   // Get the rank of the token inside the group before we drop the reference.
   int rank = group->rank.fetch_add(1);
 
@@ -279,6 +276,18 @@ extern "C" int64_t mlirAsyncRuntimeAddTokenToGroup(AsyncToken *token,
     }
   };
 
+  // Fast path: the token already reached a terminal state (states never leave
+  // it), so the group bookkeeping can be updated right away and only the group
+  // mutex is needed to guard its awaiters.
+  if (State(token->state).isAvailableOrError()) {
+    std::unique_lock<std::mutex> lockGroup(group->mu);
+    onTokenReady();
+    return rank;
+  }
+
+  std::unique_lock<std::mutex> lockToken(token->mu);
+  std::unique_lock<std::mutex> lockGroup(group->mu);
+
   if (State(token->state).isAvailableOrError()) {
     // Update group pending tokens immediately and maybe run awaiters.
     onTokenReady();
@@ -369,6 +378,9 @@ extern "C" bool mlirAsyncRuntimeIsGroupError(AsyncGroup *group) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
+  // Fast path: completed states are terminal, so no lock is needed.
+  if (State(token->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(token->mu);
   if (!State(token->state).isAvailableOrError())
     token->cv.wait(
@@ -376,6 +388,9 @@ extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitValue(AsyncValue *value) {
+  // Fast path: completed states are terminal, so no lock is needed.
+  if (State(value->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(value->mu);
   if (!State(value->state).isAvailableOrError())
     value->cv.wait(
@@ -383,6 +398,9 @@ extern "C" void mlirAsyncRuntimeAwaitValue(AsyncValue *value) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitAllInGroup(AsyncGroup *group) {
+  // Fast path: pending tokens never go back up once they reach zero.
+  if (group->pendingTokens == 0)
+    return;
   std::unique_lock<std::mutex> lock(group->mu);
   if (group->pendingTokens != 0)
     group->cv.wait(lock, [group] { return group->pendingTokens == 0; });
@@ -403,6 +421,9 @@ extern "C" void mlirAsyncRuntimeAwaitTokenAndExecute(AsyncToken *token,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  // Fast path: completed states are terminal, so no lock is needed.
+  if (State(token->state).isAvailableOrError())
+    return execute();
   std::unique_lock<std::mutex> lock(token->mu);
   if (State(token->state).isAvailableOrError()) {
     lock.unlock();
@@ -416,6 +437,9 @@ extern "C" void mlirAsyncRuntimeAwaitValueAndExecute(AsyncValue *value,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  // Fast path: completed states are terminal, so no lock is needed.
+  if (State(value->state).isAvailableOrError())
+    return execute();
   std::unique_lock<std::mutex> lock(value->mu);
   if (State(value->state).isAvailableOrError()) {
     lock.unlock();
@@ -429,6 +453,9 @@ extern "C" void mlirAsyncRuntimeAwaitAllInGroupAndExecute(AsyncGroup *group,
                                                           CoroHandle handle,
                                                           CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  // Fast path: pending tokens never go back up once they reach zero.
+  if (group->pendingTokens == 0)
+    return execute();
   std::unique_lock<std::mutex> lock(group->mu);
   if (group->pendingTokens == 0) {
     lock.unlock();
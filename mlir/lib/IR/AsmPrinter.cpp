@@ -38,9 +38,11 @@
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/Alignment.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Endian.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Regex.h"
 #include "llvm/Support/SaveAndRestore.h"
 #include "llvm/Support/Threading.h"
@@ -1270,6 +1272,33 @@ AsmResourceBuilder::~AsmResourceBuilder() = default;
 AsmResourceParser::~AsmResourceParser() = default;
 AsmResourcePrinter::~AsmResourcePrinter() = default;
 
+AsmResourceBlob FileAsmResourceBlob::mapFile(StringRef path,
+                                             size_t dataAlignment,
+                                             std::string *errorMessage) {
+  ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer =
+      llvm::MemoryBuffer::getFile(path, /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
+  if (std::error_code ec = buffer.getError()) {
+    if (errorMessage)
+      *errorMessage = "cannot open file '" + path.str() + "': " + ec.message();
+    return AsmResourceBlob();
+  }
+  ArrayRef<char> data((*buffer)->getBufferStart(), (*buffer)->getBufferSize());
+  if (!llvm::isAddrAligned(llvm::Align(dataAlignment), data.data())) {
+    if (errorMessage)
+      *errorMessage = "contents of file '" + path.str() +
+                      "' do not satisfy the required alignment";
+    return AsmResourceBlob();
+  }
+
+  // Transfer ownership of the buffer into the blob's deleter so that the
+  // mapping lives exactly as long as the blob.
+  return AsmResourceBlob(
+      data, dataAlignment,
+      [buffer = std::move(*buffer)](void *, size_t, size_t) {},
+      /*dataIsMutable=*/false);
+}
+
 //===----------------------------------------------------------------------===//
 // AsmState
 //===----------------------------------------------------------------------===//
@@ -711,6 +711,9 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
     Operation *op;
     /// The analysis manager for the operation.
     AnalysisManager am;
+    /// The number of operations nested within `op`, used to schedule the
+    /// largest operations first.
+    unsigned numOps = 0;
   };
 
   // Run a prepass over the operation to collect the nested operations to
@@ -728,11 +731,22 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
       }
 
       // If this operation can be scheduled, add it to the list.
-      if (pmIdxIt.first->second)
+      if (pmIdxIt.first->second) {
         opInfos.emplace_back(*pmIdxIt.first->second, &op, am.nest(&op));
+        op.walk([&](Operation *) { ++opInfos.back().numOps; });
+      }
     }
   }
 
+  // Process the largest operations first. The executors below pull work from
+  // the queue dynamically, so this implements longest-processing-time
+  // scheduling: a large operation that would otherwise be picked up last ends
+  // up running alone after the rest of the queue has drained.
+  if (opInfos.size() > 1)
+    llvm::stable_sort(opInfos, [](const OpPMInfo &lhs, const OpPMInfo &rhs) {
+      return lhs.numOps > rhs.numOps;
+    });
+
   // Get the current thread for this adaptor.
   PassInstrumentation::PipelineParentInfo parentInfo = {llvm::get_threadid(),
                                                         this};
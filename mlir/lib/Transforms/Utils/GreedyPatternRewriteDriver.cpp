@@ -149,13 +149,19 @@ bool GreedyPatternRewriteDriver::simplify(MutableArrayRef<Region> regions) {
     worklistMap.clear();
 
     if (!config.useTopDownTraversal) {
-      // Add operations to the worklist in postorder.
+      // Add operations to the worklist in postorder. The walk visits each
+      // operation exactly once, so the worklist map can be built in bulk
+      // afterwards instead of probing it per insertion.
       for (auto &region : regions) {
         region.walk([&](Operation *op) {
           if (!insertKnownConstant(op))
-            addToWorklist(op);
+            worklist.push_back(op);
         });
       }
+
+      worklistMap.reserve(worklist.size());
+      for (size_t i = 0, e = worklist.size(); i != e; ++i)
+        worklistMap[worklist[i]] = i;
     } else {
       // Add all nested operations to the worklist in preorder.
       for (auto &region : regions) {
@@ -171,6 +177,7 @@ bool GreedyPatternRewriteDriver::simplify(MutableArrayRef<Region> regions) {
       // Reverse the list so our pop-back loop processes them in-order.
       std::reverse(worklist.begin(), worklist.end());
       // Remember the reverse index.
+      worklistMap.reserve(worklist.size());
       for (size_t i = 0, e = worklist.size(); i != e; ++i)
         worklistMap[worklist[i]] = i;
     }
@@ -291,12 +298,10 @@ bool GreedyPatternRewriteDriver::simplify(MutableArrayRef<Region> regions) {
 }
 
 void GreedyPatternRewriteDriver::addToWorklist(Operation *op) {
-  // Check to see if the worklist already contains this op.
-  if (worklistMap.count(op))
-    return;
-
-  worklistMap[op] = worklist.size();
-  worklist.push_back(op);
+  // Check to see if the worklist already contains this op, inserting the new
+  // index if not. A single try_emplace avoids hashing the op twice.
+  if (worklistMap.try_emplace(op, worklist.size()).second)
+    worklist.push_back(op);
 }
 
 Operation *GreedyPatternRewriteDriver::popFromWorklist() {
@@ -655,16 +655,12 @@ static void applyToShadowMapEntries(DeviceTy &Device, CBTy CB, void *Begin,
   uintptr_t UB = LB + Size;
   // Now we are looking into the shadow map so we need to lock it.
   std::lock_guard<decltype(Device.ShadowMtx)> LG(Device.ShadowMtx);
-  for (ShadowPtrListTy::iterator Itr = Device.ShadowPtrMap.begin();
+  // An STL map is sorted on its keys; use this property to start at the first
+  // entry in the range and to stop as soon as we are past it.
+  for (ShadowPtrListTy::iterator Itr = Device.ShadowPtrMap.lower_bound(Begin);
        Itr != Device.ShadowPtrMap.end();) {
     uintptr_t ShadowHstPtrAddr = (uintptr_t)Itr->first;
 
-    // An STL map is sorted on its keys; use this property
-    // to quickly determine when to break out of the loop.
-    if (ShadowHstPtrAddr < LB) {
-      ++Itr;
-      continue;
-    }
     if (ShadowHstPtrAddr >= UB)
       break;
 
@@ -923,13 +923,16 @@ static void __kmp_fork_team_threads(kmp_root_t *root, kmp_team_t *team,
   KMP_DEBUG_ASSERT(master_gtid == __kmp_get_gtid());
   KMP_MB();
 
-  /* first, let's setup the primary thread */
-  master_th->th.th_info.ds.ds_tid = 0;
-  master_th->th.th_team = team;
-  master_th->th.th_team_nproc = team->t.t_nproc;
-  master_th->th.th_team_master = master_th;
-  master_th->th.th_team_serialized = FALSE;
-  master_th->th.th_dispatch = &team->t.t_dispatch[0];
+  /* first, let's setup the primary thread. When re-forking a hot team these
+     fields are usually unchanged, so only do the assignments if they prevent
+     cache ping-pong: workers read these lines while spinning in the fork
+     barrier. */
+  KMP_CHECK_UPDATE(master_th->th.th_info.ds.ds_tid, 0);
+  KMP_CHECK_UPDATE(master_th->th.th_team, team);
+  KMP_CHECK_UPDATE(master_th->th.th_team_nproc, team->t.t_nproc);
+  KMP_CHECK_UPDATE(master_th->th.th_team_master, master_th);
+  KMP_CHECK_UPDATE(master_th->th.th_team_serialized, FALSE);
+  KMP_CHECK_UPDATE(master_th->th.th_dispatch, &team->t.t_dispatch[0]);
 
 /* make sure we are not the optimized hot team */
 #if KMP_NESTED_HOT_TEAMS
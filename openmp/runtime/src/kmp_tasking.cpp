@@ -2872,6 +2872,15 @@ static kmp_task_t *__kmp_get_priority_task(kmp_int32 gtid,
   do {
     KMP_ASSERT(list != NULL);
     thread_data = &list->td;
+    // Skip queues that are observably empty without paying for their lock;
+    // the task count is re-checked under the lock before a task is taken.
+    if (TCR_4(thread_data->td.td_deque_ntasks) == 0) {
+      KA_TRACE(20, ("__kmp_get_priority_task: T#%d No tasks to get from %p\n",
+                    __kmp_get_gtid(), thread_data));
+      deque_ntasks = 0;
+      list = list->next;
+      continue;
+    }
     __kmp_acquire_bootstrap_lock(&thread_data->td.td_deque_lock);
     deque_ntasks = thread_data->td.td_deque_ntasks;
     if (deque_ntasks == 0) {
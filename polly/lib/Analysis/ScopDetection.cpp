@@ -50,6 +50,7 @@
 #include "polly/Support/SCEVValidator.h"
 #include "polly/Support/ScopHelper.h"
 #include "polly/Support/ScopLocation.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AliasAnalysis.h"
@@ -1358,12 +1359,13 @@ bool ScopDetection::isValidLoop(Loop *L, DetectionContext &Context) {
 ScopDetection::LoopStats
 ScopDetection::countBeneficialSubLoops(Loop *L, ScalarEvolution &SE,
                                        unsigned MinProfitableTrips) {
-  auto *TripCount = SE.getBackedgeTakenCount(L);
-
   int NumLoops = 1;
   int MaxLoopDepth = 1;
+  // Only the profitability heuristic needs the trip count; the statistics
+  // callers pass MinProfitableTrips == 0, so do not force SCEV to compute the
+  // backedge-taken count for them.
   if (MinProfitableTrips > 0)
-    if (auto *TripCountC = dyn_cast<SCEVConstant>(TripCount))
+    if (auto *TripCountC = dyn_cast<SCEVConstant>(SE.getBackedgeTakenCount(L)))
       if (TripCountC->getType()->getScalarSizeInBits() <= 64)
         if (TripCountC->getValue()->getZExtValue() <= MinProfitableTrips)
           NumLoops -= 1;
@@ -1392,10 +1394,10 @@ ScopDetection::countBeneficialLoops(Region *R, ScalarEvolution &SE,
     L = L->getParentLoop();
   }
 
-  auto SubLoops =
-      L ? L->getSubLoopsVector() : std::vector<Loop *>(LI.begin(), LI.end());
+  ArrayRef<Loop *> SubLoops =
+      L ? L->getSubLoops() : LI.getTopLevelLoops();
 
-  for (auto &SubLoop : SubLoops)
+  for (auto *SubLoop : SubLoops)
     if (R->contains(SubLoop)) {
       LoopStats Stats =
           countBeneficialSubLoops(SubLoop, SE, MinProfitableTrips);
@@ -364,7 +364,7 @@ void IslNodeBuilder::getReferencesInSubtree(const isl::ast_node &For,
   for (Value *V : Values) {
     ReplacedValues.insert(getLatestValue(V));
   }
-  Values = ReplacedValues;
+  Values = std::move(ReplacedValues);
 }
 
 void IslNodeBuilder::updateValues(ValueMapT &NewValues) {
@@ -736,7 +736,7 @@ void IslNodeBuilder::createForParallel(__isl_take isl_ast_node *For) {
 
   ValueMapT NewValuesReverse;
 
-  for (auto P : NewValues)
+  for (const auto &P : NewValues)
     NewValuesReverse[P.second] = P.first;
 
   Annotator.addAlternativeAliasBases(NewValuesReverse);
@@ -745,8 +745,8 @@ void IslNodeBuilder::createForParallel(__isl_take isl_ast_node *For) {
 
   Annotator.resetAlternativeAliasBases();
   // Restore the original values.
-  ValueMap = ValueMapCopy;
-  IDToValue = IDToValueCopy;
+  ValueMap = std::move(ValueMapCopy);
+  IDToValue = std::move(IDToValueCopy);
 
   Builder.SetInsertPoint(&*AfterLoop);
   removeSubFuncFromDomTree((*LoopBody).getParent()->getParent(), DT);
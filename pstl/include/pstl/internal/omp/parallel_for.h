@@ -44,6 +44,14 @@ template <class _ExecutionPolicy, class _Index, class _Fp>
 void
 __parallel_for(__pstl::__internal::__openmp_backend_tag, _ExecutionPolicy&&, _Index __first, _Index __last, _Fp __f)
 {
+    // A range that fits in a single chunk is cheaper to run in place than to
+    // hand to a parallel region, matching __parallel_reduce.
+    if (__omp_backend::__should_run_serial(__first, __last))
+    {
+        __f(__first, __last);
+        return;
+    }
+
     if (omp_in_parallel())
     {
         // we don't create a nested parallel region in an existing parallel
@@ -39,6 +39,15 @@ template <class _ExecutionPolicy, class _ForwardIterator, class _Fp>
 void
 __parallel_for_each(_ExecutionPolicy&&, _ForwardIterator __first, _ForwardIterator __last, _Fp __f)
 {
+    // A range that fits in a single chunk is cheaper to run in place than to
+    // hand to a parallel region, matching __parallel_reduce.
+    if (__omp_backend::__should_run_serial(__first, __last))
+    {
+        for (auto __iter = __first; __iter != __last; ++__iter)
+            __f(*__iter);
+        return;
+    }
+
     if (omp_in_parallel())
     {
         // we don't create a nested parallel region in an existing parallel